@@ -180,11 +180,13 @@ static void UpdatePlaybackRate(void)
         time_ratio *= spc::dynamic_rate_multiplier;
     }
 
+    spc::resampler->quality(Settings.ResamplerQuality);
     spc::resampler->time_ratio(time_ratio);
 
     if (Settings.MSU1)
     {
         time_ratio = (44100.0 / Settings.SoundPlaybackRate) * (Settings.SoundInputRate / 32040.0);
+        msu::resampler->quality(Settings.ResamplerQuality);
         msu::resampler->time_ratio(time_ratio);
     }
 }
@@ -304,17 +306,23 @@ void S9xAPUSetReferenceTime(int32 cpucycles)
     spc::reference_time = cpucycles;
 }
 
-void S9xAPUExecute(void)
+// Gives the SMP the clocks for the CPU time since the last call, without running it
+static void S9xAPUAddTime(void)
 {
     SNES::smp.clock -= S9xAPUGetClock(CPU.Cycles);
-    SNES::smp.enter();
 
     spc::remainder = S9xAPUGetClockRemainder(CPU.Cycles);
 
     S9xAPUSetReferenceTime(CPU.Cycles);
 }
 
-void S9xAPUEndScanline(void)
+void S9xAPUExecute(void)
+{
+    S9xAPUAddTime();
+    SNES::smp.enter();
+}
+
+void S9xAPUCatchUp(void)
 {
     S9xAPUExecute();
     SNES::dsp.synchronize();
@@ -323,6 +331,21 @@ void S9xAPUEndScanline(void)
         S9xLandSamples();
 }
 
+void S9xAPUEndScanline(void)
+{
+    // The SMP only talks to the CPU through the ports, which catch it up. Otherwise it can wait
+    // until a block of samples is due. The DSP then falls further behind the SMP's writes to
+    // sample RAM than it does when synchronized every scanline, so this is optional.
+    if (Settings.LazyAPUSync && spc::sound_in_sync)
+    {
+        S9xAPUAddTime();
+        if (-SNES::smp.clock < APU_SAMPLE_BLOCK / 2 * 32)
+            return;
+    }
+
+    S9xAPUCatchUp();
+}
+
 void S9xAPUTimingSetSpeedup(int ticks)
 {
     if (ticks != 0)
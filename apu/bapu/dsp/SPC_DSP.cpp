@@ -7,6 +7,10 @@
 #include "blargg_endian.h"
 #include <string.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /* Copyright (C) 2007 Shay Green. This module is free software; you
 can redistribute it and/or modify it under the terms of the GNU Lesser
 General Public License as published by the Free Software Foundation; either
@@ -649,10 +653,19 @@ inline void SPC_DSP::run_envelope( voice_t* const v )
 
 //// BRR Decoding
 
+inline bool SPC_DSP::brr_cache_valid( brr_cache_t const* c, int addr ) const
+{
+	return brr_page_gen [addr >> 8] == c->gen [0] &&
+			brr_page_gen [((addr + brr_block_size - 1) & 0xFFFF) >> 8] == c->gen [1];
+}
+
 inline void SPC_DSP::decode_brr( voice_t* v )
 {
+	int const addr    = v->brr_addr;
+	int const quarter = v->brr_offset >> 1; // which four samples of the block
+
 	// Arrange the four input nybbles in 0xABCD order for easy decoding
-	int nybbles = m.t_brr_byte * 0x100 + m.ram [(v->brr_addr + v->brr_offset + 1) & 0xFFFF];
+	int nybbles = m.t_brr_byte * 0x100 + m.ram [(addr + v->brr_offset + 1) & 0xFFFF];
 
 	int const header = m.t_brr_header;
 
@@ -662,6 +675,55 @@ inline void SPC_DSP::decode_brr( voice_t* v )
 	if ( (v->buf_pos += 4) >= brr_buf_size )
 		v->buf_pos = 0;
 
+	// Blocks are cached whole, keyed by what the filter depends on: header,
+	// RAM contents and the two previous samples
+	brr_cache_t* c;
+	if ( quarter == 0 )
+	{
+		c = &brr_cache [addr & (brr_cache_size - 1)];
+		if ( c->addr == addr && c->header == header &&
+				c->hist [0] == pos [brr_buf_size - 1] && c->hist [1] == pos [brr_buf_size - 2] &&
+				brr_cache_valid( c, addr ) )
+		{
+			v->brr_cache_hit = true;
+		}
+		else
+		{
+			// Fill this entry while the block is decoded
+			c->addr     = -1;
+			c->owner    = v->voice_number;
+			c->header   = header;
+			c->hist [0] = pos [brr_buf_size - 1];
+			c->hist [1] = pos [brr_buf_size - 2];
+			c->gen  [0] = brr_page_gen [addr >> 8];
+			c->gen  [1] = brr_page_gen [((addr + brr_block_size - 1) & 0xFFFF) >> 8];
+			v->brr_cache_hit = false;
+		}
+		v->brr_cache = c;
+	}
+
+	c = v->brr_cache;
+	if ( c && v->brr_cache_hit && c->addr == addr && brr_cache_valid( c, addr ) )
+	{
+		short const* in = &c->samples [quarter * 4];
+		pos [brr_buf_size    ] = pos [0] = in [0];
+		pos [brr_buf_size + 1] = pos [1] = in [1];
+		pos [brr_buf_size + 2] = pos [2] = in [2];
+		pos [brr_buf_size + 3] = pos [3] = in [3];
+		return;
+	}
+
+	// Only fill from what is in RAM now; a byte read earlier may since have changed,
+	// and the header is ignored right after KON
+	short* out = NULL;
+	if ( c && !v->brr_cache_hit && c->addr == -1 && c->owner == v->voice_number )
+	{
+		if ( header == m.ram [addr] && m.t_brr_byte == m.ram [(addr + v->brr_offset) & 0xFFFF] )
+			out = &c->samples [quarter * 4];
+		else
+			c->owner = -1;
+	}
+
 	// Decode four samples
 	for ( end = pos + 4; pos < end; pos++, nybbles <<= 4 )
 	{
@@ -703,7 +765,25 @@ inline void SPC_DSP::decode_brr( voice_t* v )
 		CLAMP16( s );
 		s = (int16_t) (s * 2);
 		pos [brr_buf_size] = pos [0] = s; // second copy simplifies wrap-around
+
+		if ( out )
+			*out++ = s;
+	}
+
+	if ( out && quarter == 3 && brr_cache_valid( c, addr ) )
+		c->addr = addr;
+}
+
+void SPC_DSP::clear_brr_cache()
+{
+	for ( int i = 0; i < brr_cache_size; i++ )
+	{
+		brr_cache [i].addr  = -1;
+		brr_cache [i].owner = -1;
 	}
+
+	for ( int i = 0; i < voice_count; i++ )
+		m.voices [i].brr_cache = NULL;
 }
 
 
@@ -984,25 +1064,33 @@ ECHO_CLOCK( 22 )
 
 	m.t_echo_ptr = (m.t_esa * 0x100 + m.echo_offset) & 0xFFFF;
 	echo_read( 0 );
+}
+ECHO_CLOCK( 23 )
+{
+	echo_read( 1 );
+}
+
+// FIR, spread over the clocks the coefficients are read on
+#define FIR_CLOCK( n ) inline void SPC_DSP::fir_##n()
 
-	// FIR (using l and r temporaries below helps compiler optimize)
+FIR_CLOCK( 22 )
+{
+	// (using l and r temporaries below helps compiler optimize)
 	int l = CALC_FIR( 0, 0 );
 	int r = CALC_FIR( 0, 1 );
 
 	m.t_echo_in [0] = l;
 	m.t_echo_in [1] = r;
 }
-ECHO_CLOCK( 23 )
+FIR_CLOCK( 23 )
 {
 	int l = CALC_FIR( 1, 0 ) + CALC_FIR( 2, 0 );
 	int r = CALC_FIR( 1, 1 ) + CALC_FIR( 2, 1 );
 
 	m.t_echo_in [0] += l;
 	m.t_echo_in [1] += r;
-
-	echo_read( 1 );
 }
-ECHO_CLOCK( 24 )
+FIR_CLOCK( 24 )
 {
 	int l = CALC_FIR( 3, 0 ) + CALC_FIR( 4, 0 ) + CALC_FIR( 5, 0 );
 	int r = CALC_FIR( 3, 1 ) + CALC_FIR( 4, 1 ) + CALC_FIR( 5, 1 );
@@ -1010,7 +1098,7 @@ ECHO_CLOCK( 24 )
 	m.t_echo_in [0] += l;
 	m.t_echo_in [1] += r;
 }
-ECHO_CLOCK( 25 )
+FIR_CLOCK( 25 )
 {
 	int l = m.t_echo_in [0] + CALC_FIR( 6, 0 );
 	int r = m.t_echo_in [1] + CALC_FIR( 6, 1 );
@@ -1027,6 +1115,63 @@ ECHO_CLOCK( 25 )
 	m.t_echo_in [0] = l & ~1;
 	m.t_echo_in [1] = r & ~1;
 }
+
+// Same as fir_22() to fir_25() together, for when no register can be written
+// in between. The history used doesn't change over those clocks.
+inline void SPC_DSP::echo_fir()
+{
+	int l, r;
+
+#ifdef __SSE2__
+	// Each vector holds left and right of two taps. History and coefficients fit
+	// in 16 bits, so the low and high halves of the products are put back together.
+	int const* hist = ECHO_FIR( 1 );
+	__m128i h0 = _mm_packs_epi32( _mm_loadu_si128( (__m128i const*) (hist     ) ),
+			_mm_loadu_si128( (__m128i const*) (hist +  4) ) );
+	__m128i h1 = _mm_packs_epi32( _mm_loadu_si128( (__m128i const*) (hist +  8) ),
+			_mm_loadu_si128( (__m128i const*) (hist + 12) ) );
+
+	#define FIR_COEF( i ) (int8_t) REG(fir + i * 0x10)
+	__m128i c0 = _mm_set_epi16( FIR_COEF( 3 ), FIR_COEF( 3 ), FIR_COEF( 2 ), FIR_COEF( 2 ),
+			FIR_COEF( 1 ), FIR_COEF( 1 ), FIR_COEF( 0 ), FIR_COEF( 0 ) );
+	__m128i c1 = _mm_set_epi16( FIR_COEF( 7 ), FIR_COEF( 7 ), FIR_COEF( 6 ), FIR_COEF( 6 ),
+			FIR_COEF( 5 ), FIR_COEF( 5 ), FIR_COEF( 4 ), FIR_COEF( 4 ) );
+	#undef FIR_COEF
+
+	__m128i lo0 = _mm_mullo_epi16( h0, c0 ), hi0 = _mm_mulhi_epi16( h0, c0 );
+	__m128i lo1 = _mm_mullo_epi16( h1, c1 ), hi1 = _mm_mulhi_epi16( h1, c1 );
+
+	__m128i t01 = _mm_srai_epi32( _mm_unpacklo_epi16( lo0, hi0 ), 6 ); // taps 0, 1
+	__m128i t23 = _mm_srai_epi32( _mm_unpackhi_epi16( lo0, hi0 ), 6 ); // taps 2, 3
+	__m128i t45 = _mm_srai_epi32( _mm_unpacklo_epi16( lo1, hi1 ), 6 ); // taps 4, 5
+	__m128i t67 = _mm_srai_epi32( _mm_unpackhi_epi16( lo1, hi1 ), 6 ); // taps 6, 7
+
+	// Taps 0 to 6 in the low half, tap 7 in the high half
+	__m128i sum = _mm_add_epi32( _mm_add_epi32( t01, t23 ), t45 );
+	sum = _mm_add_epi32( _mm_add_epi32( sum, _mm_unpackhi_epi64( sum, sum ) ), t67 );
+
+	int out [4];
+	_mm_storeu_si128( (__m128i*) out, sum );
+	l = (int16_t) out [0];
+	r = (int16_t) out [1];
+	l += (int16_t) _mm_cvtsi128_si32( _mm_srli_si128( t67, 8 ) );
+	r += (int16_t) _mm_cvtsi128_si32( _mm_srli_si128( t67, 12 ) );
+#else
+	l = (int16_t) (CALC_FIR( 0, 0 ) + CALC_FIR( 1, 0 ) + CALC_FIR( 2, 0 ) + CALC_FIR( 3, 0 ) +
+			CALC_FIR( 4, 0 ) + CALC_FIR( 5, 0 ) + CALC_FIR( 6, 0 ));
+	r = (int16_t) (CALC_FIR( 0, 1 ) + CALC_FIR( 1, 1 ) + CALC_FIR( 2, 1 ) + CALC_FIR( 3, 1 ) +
+			CALC_FIR( 4, 1 ) + CALC_FIR( 5, 1 ) + CALC_FIR( 6, 1 ));
+
+	l += (int16_t) CALC_FIR( 7, 0 );
+	r += (int16_t) CALC_FIR( 7, 1 );
+#endif
+
+	CLAMP16( l );
+	CLAMP16( r );
+
+	m.t_echo_in [0] = l & ~1;
+	m.t_echo_in [1] = r & ~1;
+}
 inline int SPC_DSP::echo_output( int ch )
 {
 	int out = (int16_t) ((m.t_main_out [ch] * (int8_t) REG(mvoll + ch * 0x10)) >> 7) +
@@ -1082,7 +1227,11 @@ ECHO_CLOCK( 28 )
 inline void SPC_DSP::echo_write( int ch )
 {
 	if ( !(m.t_echo_enabled & 0x20) )
+	{
 		SET_LE16A( ECHO_PTR( ch ), m.t_echo_out [ch] );
+		if ( !Settings.SeparateEchoBuffer )
+			ram_written( m.t_echo_ptr );
+	}
 
 	m.t_echo_out [ch] = 0;
 }
@@ -1146,10 +1295,10 @@ PHASE(18)                                     V(V8_V5_V2,5)\
 PHASE(19)                                     V(V9_V6_V3,5)\
 PHASE(20)         V(V1,1)                            V(V7,6)V(V4,7)\
 PHASE(21)                                            V(V8,6)V(V5,7)  V(V2,0)  /* t_brr_next_addr order dependency */\
-PHASE(22)  V(V3a,0)                                  V(V9,6)V(V6,7)  echo_22();\
-PHASE(23)                                                   V(V7,7)  echo_23();\
-PHASE(24)                                                   V(V8,7)  echo_24();\
-PHASE(25)  V(V3b,0)                                         V(V9,7)  echo_25();\
+PHASE(22)  V(V3a,0)                                  V(V9,6)V(V6,7)  echo_22(); FIR(22)\
+PHASE(23)                                                   V(V7,7)  echo_23(); FIR(23)\
+PHASE(24)                                                   V(V8,7)  FIR(24)\
+PHASE(25)  V(V3b,0)                                         V(V9,7)  FIR(25)\
 PHASE(26)                                                            echo_26();\
 PHASE(27) misc_27();                                                 echo_27();\
 PHASE(28) misc_28();                                                 echo_28();\
@@ -1170,11 +1319,27 @@ void SPC_DSP::run( int clocks_remain )
 	loop:
 
 		#define PHASE( n ) if ( n && !--clocks_remain ) break; /* Fall through */ case n:
+		#define FIR( n ) fir_##n();
 		GEN_DSP_TIMING
+		#undef FIR
 		#undef PHASE
 
 		if ( --clocks_remain )
-			goto loop;
+		{
+			// Registers can't be written during a run, so whole samples don't
+			// need to stop between clocks and can do the FIR in one step
+			for ( ; clocks_remain >= 32; clocks_remain -= 32 )
+			{
+				#define PHASE( n )
+				#define FIR( n ) if ( n == 25 ) echo_fir();
+				GEN_DSP_TIMING
+				#undef FIR
+				#undef PHASE
+			}
+
+			if ( clocks_remain )
+				goto loop;
+		}
 	}
 }
 
@@ -1227,6 +1392,8 @@ void SPC_DSP::soft_reset_common()
 
 	for (int i = 0; i < voice_count; i++)
 		m.voices[i].voice_number = i;
+
+	clear_brr_cache();
 }
 
 void SPC_DSP::soft_reset()
@@ -67,6 +67,13 @@ public:
 	// Returns non-zero if new key-on events occurred since last call
 	bool check_kon();
 
+	// Must be called whenever something other than the DSP writes to RAM, so that
+	// cached BRR blocks in that page are decoded again
+	void ram_written( int addr );
+
+	// Forgets all cached BRR blocks, for when RAM is replaced wholesale
+	void clear_brr_cache();
+
 // Snes9x Accessor
 
 	int     stereo_switch;
@@ -118,6 +125,16 @@ public:
 
 	enum env_mode_t { env_release, env_attack, env_decay, env_sustain };
 	enum { brr_buf_size = 12 };
+	enum { brr_cache_size = 1024 };
+	struct brr_cache_t
+	{
+		int addr;               // address of decoded BRR block, -1 while being filled
+		int header;             // header it was decoded with
+		int hist [2];           // two samples decoded before the block
+		unsigned gen [2];       // brr_page_gen of the block's first and last page
+		int owner;              // voice filling the entry
+		short samples [16];
+	};
 	struct voice_t
 	{
 		int buf [brr_buf_size*2];// decoded samples (twice the size to simplify wrap handling)
@@ -133,6 +150,8 @@ public:
 		int hidden_env;         // used by GAIN mode 7, very obscure quirk
 		uint8_t t_envx_out;
 		int voice_number;
+		brr_cache_t* brr_cache; // cache entry for current BRR block
+		bool brr_cache_hit;     // true if block is played from brr_cache
 	};
 private:
 	enum { brr_block_size = 9 };
@@ -207,6 +226,11 @@ private:
 	};
 	state_t m;
 
+	// Decoded BRR blocks, indexed by block address. An entry is only used while the
+	// write counts of the pages holding its block are unchanged.
+	brr_cache_t brr_cache [brr_cache_size];
+	unsigned brr_page_gen [0x100];
+
 	void init_counter();
 	void run_counters();
 	unsigned read_counter( int rate );
@@ -214,6 +238,7 @@ private:
 	int  interpolate( voice_t const* v );
 	void run_envelope( voice_t* const v );
 	void decode_brr( voice_t* v );
+	bool brr_cache_valid( brr_cache_t const* c, int addr ) const;
 
 	void misc_27();
 	void misc_28();
@@ -242,8 +267,11 @@ private:
 	void echo_write( int ch );
 	void echo_22();
 	void echo_23();
-	void echo_24();
-	void echo_25();
+	void fir_22();
+	void fir_23();
+	void fir_24();
+	void fir_25();
+	void echo_fir();
 	void echo_26();
 	void echo_27();
 	void echo_28();
@@ -293,6 +321,12 @@ inline void SPC_DSP::write( int addr, int data )
 
 inline void SPC_DSP::mute_voices( int mask ) { m.mute_mask = mask; }
 
+inline void SPC_DSP::ram_written( int addr )
+{
+	if ( !++brr_page_gen [(addr >> 8) & 0xFF] )
+		clear_brr_cache(); // wrapped around, old entries could match again
+}
+
 inline bool SPC_DSP::check_kon()
 {
 	bool old = m.kon_check;
@@ -40,6 +40,7 @@ void DSP::save_state (uint8 **ptr)
 void DSP::load_state (uint8 **ptr)
 {
 	spc_dsp.copy_state(ptr, to_dsp_from_state);
+	spc_dsp.clear_brr_cache();
 }
 
 DSP::DSP()
@@ -35,6 +35,7 @@ void SMP::op_write(uint16 addr, uint8 data) {
   tick();
   if((addr & 0xfff0) == 0x00f0) mmio_write(addr, data);
   apuram[addr] = data;  //all writes go to RAM, even MMIO writes
+  dsp.spc_dsp.ram_written(addr);
 }
 
 uint8 SMP::op_readstack()
@@ -47,6 +48,7 @@ void SMP::op_writestack(uint8 data)
 {
   tick();
   apuram[0x0100 | regs.sp--] = data;
+  dsp.spc_dsp.ram_written(0x0100);
 }
 
 void SMP::op_step() {
@@ -56,6 +58,18 @@ void SMP::op_step() {
   #define op_readaddr(addr) op_read(addr)
   #define op_writeaddr(addr, data) op_write(addr, data)
 
+#ifdef PROFILER
+  // Cycle-stepped opcodes return partway through and resume on the next
+  // call, so an opcode is charged once, with the clocks of every step.
+  int32 profile_clock = clock;
+
+  if(opcode_cycle == 0)
+  {
+    profile_pc = regs.pc;
+    profile_cycles = 0;
+  }
+#endif
+
   if(opcode_cycle == 0)
   {
 #ifdef DEBUGGER
@@ -75,4 +89,11 @@ void SMP::op_step() {
     #include "core/oppseudo_read.cpp"
     #include "core/oppseudo_rmw.cpp"
   }
+
+#ifdef PROFILER
+  profile_cycles += clock - profile_clock;
+
+  if(opcode_cycle == 0)
+    S9xProfileOp(PROFILE_SMP, profile_pc, opcode_number, profile_cycles);
+#endif
 }
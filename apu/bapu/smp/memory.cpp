@@ -4,6 +4,7 @@ unsigned SMP::port_read(unsigned addr) {
 
 void SMP::port_write(unsigned addr, unsigned data) {
   apuram[0xf4 + (addr & 3)] = data;
+  dsp.spc_dsp.ram_written(0x00f4);
 }
 
 unsigned SMP::mmio_read(unsigned addr) {
@@ -5,6 +5,7 @@ char tmp[1024];
 #endif
 
 #include "../snes/snes.hpp"
+#include "../../../profile.h"
 
 #define SMP_CPP
 namespace SNES {
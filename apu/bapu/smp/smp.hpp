@@ -16,6 +16,7 @@ public:
   void load_state(uint8 **);
   void save_state(uint8 **);
   void save_spc (uint8 *);
+  void load_spc (const uint8 *);
   SMP();
   ~SMP();
 
@@ -41,6 +42,10 @@ public:
 
   unsigned opcode_number;
   unsigned opcode_cycle;
+#ifdef PROFILER
+  uint16 profile_pc;
+  int64 profile_cycles;
+#endif
 
   uint16 rd, wr, dp, sp, ya, bit;
 
@@ -69,6 +69,48 @@ void SMP::save_spc (uint8 *block) {
   memcpy (block, &out, 66048);
 }
 
+void SMP::load_spc (const uint8 *block) {
+  const spc_file *in = (const spc_file *) block;
+
+  memcpy (apuram, in->apuram, 65536);
+
+  regs.pc = in->pc_low | (in->pc_high << 8);
+  regs.B.a = in->a;
+  regs.x = in->x;
+  regs.B.y = in->y;
+  regs.p = in->psw;
+  regs.sp = in->sp;
+
+  opcode_number = 0;
+  opcode_cycle = 0;
+
+  // All writes go to RAM, so the snapshot holds the last value written
+  // to each I/O register. Replay them, without clearing the ports.
+  timer0.enable = timer1.enable = timer2.enable = false;
+  timer0.stage1_ticks = timer1.stage1_ticks = timer2.stage1_ticks = 0;
+  mmio_write (0xf1, apuram[0xf1] & 0x87);
+  mmio_write (0xf2, apuram[0xf2]);
+  mmio_write (0xf8, apuram[0xf8]);
+  mmio_write (0xf9, apuram[0xf9]);
+  mmio_write (0xfa, apuram[0xfa]);
+  mmio_write (0xfb, apuram[0xfb]);
+  mmio_write (0xfc, apuram[0xfc]);
+
+  for (int i = 0; i < 4; i++)
+  {
+      cpu.port_write (i, apuram[0xf4 + i]);
+  }
+
+  timer0.stage3_ticks = apuram[0xfd] & 15;
+  timer1.stage3_ticks = apuram[0xfe] & 15;
+  timer2.stage3_ticks = apuram[0xff] & 15;
+
+  dsp.spc_dsp.load (in->dsp_registers);
+
+  clock = 0;
+  dsp.clock = 0;
+}
+
 
 void SMP::save_state(uint8 **block) {
   uint8 *ptr = *block;
@@ -15,6 +15,13 @@
 #include <stdint.h>
 #endif
 #include <cmath>
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define RESAMPLER_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RESAMPLER_NEON
+#endif
 
 class Resampler
 {
@@ -28,6 +35,17 @@ class Resampler
     float r_frac;
     int   r_left[4], r_right[4];
 
+    // Windowed-sinc filter, used when r_quality is not 0. r_table holds
+    // sinc_phases + 1 rows of r_taps coefficients, r_hist the last r_taps
+    // input samples of each channel, stored twice so they are contiguous.
+    enum { sinc_phases = 256 };
+    int    r_quality;
+    int    r_taps;
+    double r_cutoff;
+    float *r_table;
+    float *r_hist;
+    int    r_pos;
+
     static inline int16_t short_clamp(int n)
     {
         return (int16_t)(((int16_t)n != n) ? (n >> 31) ^ 0x7fff : n);
@@ -56,11 +74,82 @@ class Resampler
         return (a0 * b) + (a1 * m0) + (a2 * m1) + (a3 * c);
     }
 
+    static double bessel_i0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+
+        for (int k = 1; k < 32; k++)
+        {
+            term *= (x / (2 * k)) * (x / (2 * k));
+            sum += term;
+        }
+
+        return sum;
+    }
+
+    // Interpolates between the two coefficient rows c0 and c1 and applies
+    // the result to both channels' history. taps is a multiple of 4.
+    static inline void sinc_filter(const float *c0, const float *c1, float mu, const float *l, const float *r, int taps, float &out_l, float &out_r)
+    {
+#if defined(RESAMPLER_SSE)
+        __m128 vmu = _mm_set1_ps(mu);
+        __m128 acc_l = _mm_setzero_ps();
+        __m128 acc_r = _mm_setzero_ps();
+
+        for (int i = 0; i < taps; i += 4)
+        {
+            __m128 a = _mm_loadu_ps(c0 + i);
+            __m128 c = _mm_add_ps(a, _mm_mul_ps(vmu, _mm_sub_ps(_mm_loadu_ps(c1 + i), a)));
+            acc_l = _mm_add_ps(acc_l, _mm_mul_ps(c, _mm_loadu_ps(l + i)));
+            acc_r = _mm_add_ps(acc_r, _mm_mul_ps(c, _mm_loadu_ps(r + i)));
+        }
+
+        // Horizontal sums: lanes 0 and 1 of t end up as left and right
+        __m128 t = _mm_add_ps(_mm_unpacklo_ps(acc_l, acc_r), _mm_unpackhi_ps(acc_l, acc_r));
+        t = _mm_add_ps(t, _mm_movehl_ps(t, t));
+        out_l = _mm_cvtss_f32(t);
+        out_r = _mm_cvtss_f32(_mm_shuffle_ps(t, t, 1));
+#elif defined(RESAMPLER_NEON)
+        float32x4_t acc_l = vdupq_n_f32(0.0f);
+        float32x4_t acc_r = vdupq_n_f32(0.0f);
+
+        for (int i = 0; i < taps; i += 4)
+        {
+            float32x4_t a = vld1q_f32(c0 + i);
+            float32x4_t c = vmlaq_n_f32(a, vsubq_f32(vld1q_f32(c1 + i), a), mu);
+            acc_l = vmlaq_f32(acc_l, c, vld1q_f32(l + i));
+            acc_r = vmlaq_f32(acc_r, c, vld1q_f32(r + i));
+        }
+
+        float32x2_t t = vpadd_f32(vadd_f32(vget_low_f32(acc_l), vget_high_f32(acc_l)),
+                                  vadd_f32(vget_low_f32(acc_r), vget_high_f32(acc_r)));
+        out_l = vget_lane_f32(t, 0);
+        out_r = vget_lane_f32(t, 1);
+#else
+        float acc_l = 0.0f, acc_r = 0.0f;
+
+        for (int i = 0; i < taps; i++)
+        {
+            float c = c0[i] + mu * (c1[i] - c0[i]);
+            acc_l += c * l[i];
+            acc_r += c * r[i];
+        }
+
+        out_l = acc_l;
+        out_r = acc_r;
+#endif
+    }
+
     Resampler()
     {
         this->buffer_size = 0;
         buffer = NULL;
         r_step = 1.0;
+        r_quality = 0;
+        r_taps = 0;
+        r_cutoff = 1.0;
+        r_table = NULL;
+        r_hist = NULL;
     }
 
     Resampler(int num_samples)
@@ -68,6 +157,11 @@ class Resampler
         this->buffer_size = num_samples;
         buffer = new int16_t[this->buffer_size];
         r_step = 1.0;
+        r_quality = 0;
+        r_taps = 0;
+        r_cutoff = 1.0;
+        r_table = NULL;
+        r_hist = NULL;
         clear();
     }
 
@@ -75,11 +169,82 @@ class Resampler
     {
         delete[] buffer;
         buffer = NULL;
+        delete[] r_table;
+        delete[] r_hist;
     }
 
     inline void time_ratio(double ratio)
     {
         r_step = ratio;
+
+        // Downsampling needs a lower cutoff. Small dynamic rate changes keep the old table.
+        if (r_quality && fabs(sinc_cutoff() - r_cutoff) > r_cutoff * 0.01)
+            build_sinc_table();
+    }
+
+    // 0 selects 4-point Hermite interpolation, 1-3 a windowed-sinc filter
+    // with 16, 32 or 64 taps.
+    void quality(int q)
+    {
+        if (q < 0 || q > 3)
+            q = 0;
+        if (q == r_quality)
+            return;
+
+        r_quality = q;
+        delete[] r_table;
+        delete[] r_hist;
+        r_table = NULL;
+        r_hist = NULL;
+
+        if (r_quality)
+        {
+            r_taps = 8 << r_quality;
+            r_table = new float[(sinc_phases + 1) * r_taps];
+            r_hist = new float[r_taps * 4];
+            build_sinc_table();
+        }
+
+        clear();
+    }
+
+    double sinc_cutoff(void) const
+    {
+        // Fraction of the input Nyquist frequency where the pass band ends,
+        // chosen so the window's transition band ends at Nyquist.
+        static const double cutoff[4] = { 1.0, 0.76, 0.84, 0.90 };
+
+        return r_step > 1.0 ? cutoff[r_quality] / r_step : cutoff[r_quality];
+    }
+
+    void build_sinc_table(void)
+    {
+        static const double beta[4] = { 0.0, 6.0, 8.0, 10.0 };
+        static const double pi = 3.14159265358979323846;
+        double half = r_taps / 2;
+
+        r_cutoff = sinc_cutoff();
+
+        for (int p = 0; p <= sinc_phases; p++)
+        {
+            float *row = r_table + p * r_taps;
+            double sum = 0.0;
+
+            // The output point lies between taps r_taps / 2 - 1 and r_taps / 2
+            for (int i = 0; i < r_taps; i++)
+            {
+                double x = i - (half - 1) - (double)p / sinc_phases;
+                double w = x / half;
+                double s = x == 0.0 ? 1.0 : sin(pi * r_cutoff * x) / (pi * r_cutoff * x);
+
+                w = w * w < 1.0 ? bessel_i0(beta[r_quality] * sqrt(1.0 - w * w)) / bessel_i0(beta[r_quality]) : 0.0;
+                row[i] = (float)(s * w);
+                sum += s * w;
+            }
+
+            for (int i = 0; i < r_taps; i++)
+                row[i] = (float)(row[i] / sum);
+        }
     }
 
     inline void clear(void)
@@ -94,6 +259,10 @@ class Resampler
         r_frac = 0.0;
         r_left[0] = r_left[1] = r_left[2] = r_left[3] = 0;
         r_right[0] = r_right[1] = r_right[2] = r_right[3] = 0;
+
+        if (r_hist)
+            memset(r_hist, 0, r_taps * 4 * sizeof(float));
+        r_pos = 0;
     }
 
     inline bool pull(int16_t *dst, int num_samples)
@@ -154,6 +323,12 @@ class Resampler
             return;
         }
 
+        if (r_quality)
+        {
+            read_sinc(data, num_samples);
+            return;
+        }
+
         assert((num_samples & 1) == 0); // resampler always processes both stereo samples
         int o_position = 0;
 
@@ -197,6 +372,51 @@ class Resampler
         }
     }
 
+    void read_sinc(int16_t *data, int num_samples)
+    {
+        assert((num_samples & 1) == 0);
+        int o_position = 0;
+
+        while (o_position < num_samples && size > 0)
+        {
+            const float *l = r_hist + r_pos + 1;
+            const float *r = l + r_taps * 2;
+
+            while (r_frac <= 1.0 && o_position < num_samples)
+            {
+                float pf = r_frac * sinc_phases;
+                int p = (int)pf;
+                if (p >= sinc_phases)
+                    p = sinc_phases - 1;
+                const float *c0 = r_table + p * r_taps;
+                float out_l, out_r;
+
+                sinc_filter(c0, c0 + r_taps, pf - p, l, r, r_taps, out_l, out_r);
+                data[o_position] = short_clamp((int)out_l);
+                data[o_position + 1] = short_clamp((int)out_r);
+
+                o_position += 2;
+
+                r_frac += r_step;
+            }
+
+            if (r_frac > 1.0)
+            {
+                if (++r_pos == r_taps)
+                    r_pos = 0;
+                r_hist[r_pos] = r_hist[r_pos + r_taps] = buffer[start];
+                r_hist[r_pos + r_taps * 2] = r_hist[r_pos + r_taps * 3] = buffer[start + 1];
+
+                r_frac -= 1.0;
+
+                start += 2;
+                if (start >= buffer_size)
+                    start -= buffer_size;
+                size -= 2;
+            }
+        }
+    }
+
     inline int space_empty(void) const
     {
         return buffer_size - size;
@@ -515,6 +515,7 @@ static void BSX_Map (void)
 	BSX.dirty2 = FALSE;
 
 	Memory.map_WriteProtectROM();
+	S9xResetBlockCache();
 }
 
 static uint8 BSX_Get_Bypass_FlashIO (uint32 offset)
@@ -533,10 +534,19 @@ static void BSX_Set_Bypass_FlashIO (uint32 offset, uint8 byte)
 	//For games other than BS-X
 	FlashROM = Memory.ROM + Multi.cartOffsetB;
 
+	uint8	*p;
+
 	if (BSX.prevMMC[0x02])
-		FlashROM[offset & 0x0FFFFF] = FlashROM[offset & 0x0FFFFF] & byte;
+		p = &FlashROM[offset & 0x0FFFFF];
 	else
-		FlashROM[(offset & 0x1F0000) >> 1 | (offset & 0x7FFF)] = FlashROM[(offset & 0x1F0000) >> 1 | (offset & 0x7FFF)] & byte;
+		p = &FlashROM[(offset & 0x1F0000) >> 1 | (offset & 0x7FFF)];
+
+	// Code decoded from the flash is only stale if the byte really changes
+	if ((*p & byte) != *p)
+	{
+		*p &= byte;
+		S9xResetBlockCache();
+	}
 }
 
 uint8 S9xGetBSX (uint32 address)
@@ -705,24 +715,43 @@ void S9xSetBSX (uint8 byte, uint32 address)
 			switch (BSX.flash_command & 0xFFFF)
 			{
 				case 0x20D0: //Block Erase
+				{
+					uint8	*p;
+					if (BSX.MMC[0x02])
+						p = &FlashROM[address & 0x0F0000];
+					else
+						p = &FlashROM[(address & 0x1E0000) >> 1];
+
 					uint32 x;
+					bool8 erased = FALSE;
 					for (x = 0; x < 0x10000; x++) {
 						//BSX_Set_Bypass_FlashIO(((address & 0xFF0000) + x), 0xFF);
-						if (BSX.MMC[0x02])
-							FlashROM[(address & 0x0F0000) + x] = 0xFF;
-						else
-							FlashROM[((address & 0x1E0000) >> 1) + x] = 0xFF;
+						if (p[x] != 0xFF)
+						{
+							p[x] = 0xFF;
+							erased = TRUE;
+						}
 					}
+					if (erased)
+						S9xResetBlockCache();
 					break;
+				}
 
 				case 0xA7D0: //Chip Erase (ONLY IN TYPE 1 AND 4)
 					if ((flashcard[6] & 0xF0) == 0x10 || (flashcard[6] & 0xF0) == 0x40)
 					{
 						uint32 x;
+						bool8 erased = FALSE;
 						for (x = 0; x < FLASH_SIZE; x++) {
 							//BSX_Set_Bypass_FlashIO(x, 0xFF);
-							FlashROM[x] = 0xFF;
+							if (FlashROM[x] != 0xFF)
+							{
+								FlashROM[x] = 0xFF;
+								erased = TRUE;
+							}
 						}
+						if (erased)
+							S9xResetBlockCache();
 					}
 					break;
 
@@ -48,7 +48,6 @@ static inline uint8 S9xGetByteFree (uint32 Address)
         return (byte);
 
     case CMemory::MAP_LOROM_SRAM:
-    case CMemory::MAP_SA1RAM:
         // Address & 0x7fff   : offset into bank
         // Address & 0xff0000 : bank
         // bank >> 1 | offset : SRAM address, unbound
@@ -60,6 +59,10 @@ static inline uint8 S9xGetByteFree (uint32 Address)
         byte = *(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB));
         return (byte);
 
+    case CMemory::MAP_SA1RAM:
+        byte = *S9xGetMemPointer(Address);
+        return (byte);
+
     case CMemory::MAP_HIROM_SRAM:
     case CMemory::MAP_RONLY_SRAM:
         byte = *(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask));
@@ -116,6 +119,10 @@ static inline void S9xSetByteFree (uint8 Byte, uint32 Address)
     if (SetAddress >= (uint8 *) CMemory::MAP_LAST)
     {
         *(SetAddress + (Address & 0xffff)) = Byte;
+
+        /* Patching ROM invalidates any code decoded from it */
+        if (Memory.BlockIsROM[block])
+            S9xResetBlockCache();
         return;
     }
 
@@ -164,7 +171,7 @@ static inline void S9xSetByteFree (uint8 Byte, uint32 Address)
         return;
 
     case CMemory::MAP_SA1RAM:
-        *(Memory.SRAM + (Address & 0xffff)) = Byte;
+        *S9xGetMemPointer(Address) = Byte;
         return;
 
     case CMemory::MAP_DSP:
@@ -7,6 +7,8 @@
 #include "snes9x.h"
 #include "memmap.h"
 
+extern struct SLineData	LineData[240];
+
 static uint8	region_map[6][6] =
 {
 	{ 0, 0x01, 0x03, 0x07, 0x0f, 0x1f },
@@ -18,6 +20,7 @@ static uint8	region_map[6][6] =
 
 static inline uint8 CalcWindowMask (int, uint8, uint8);
 static inline void StoreWindowRegions (uint8, struct ClipData *, int, int16 *, uint8 *, bool8, bool8 s = FALSE);
+static void ComputeClipSpans (const uint8 *, struct ClipData (*)[6]);
 
 
 static inline uint8 CalcWindowMask (int i, uint8 W1, uint8 W2)
@@ -99,8 +102,10 @@ static inline void StoreWindowRegions (uint8 Mask, struct ClipData *Clip, int n_
 	Clip->Count = ct;
 }
 
-void S9xComputeClipWindows (void)
+static void ComputeClipSpans (const uint8 *Window, struct ClipData (*Clip)[6])
 {
+	uint8	Window1Left  = Window[0], Window1Right = Window[1];
+	uint8	Window2Left  = Window[2], Window2Right = Window[3];
 	int16	windows[6] = { 0, 256, 256, 256, 256, 256 };
 	uint8	drawing_modes[5] = { 0, 0, 0, 0, 0 };
 	int		n_regions = 1;
@@ -109,36 +114,36 @@ void S9xComputeClipWindows (void)
 	// Calculate window regions. We have at most 5 regions, because we have 6 control points
 	// (screen edges, window 1 left & right, and window 2 left & right).
 
-	if (PPU.Window1Left <= PPU.Window1Right)
+	if (Window1Left <= Window1Right)
 	{
-		if (PPU.Window1Left > 0)
+		if (Window1Left > 0)
 		{
 			windows[2] = 256;
-			windows[1] = PPU.Window1Left;
+			windows[1] = Window1Left;
 			n_regions = 2;
 		}
 
-		if (PPU.Window1Right < 255)
+		if (Window1Right < 255)
 		{
 			windows[n_regions + 1] = 256;
-			windows[n_regions] = PPU.Window1Right + 1;
+			windows[n_regions] = Window1Right + 1;
 			n_regions++;
 		}
 	}
 
-	if (PPU.Window2Left <= PPU.Window2Right)
+	if (Window2Left <= Window2Right)
 	{
 		for (i = 0; i <= n_regions; i++)
 		{
-			if (PPU.Window2Left == windows[i])
+			if (Window2Left == windows[i])
 				break;
 
-			if (PPU.Window2Left <  windows[i])
+			if (Window2Left <  windows[i])
 			{
 				for (j = n_regions; j >= i; j--)
 					windows[j + 1] = windows[j];
 
-				windows[i] = PPU.Window2Left;
+				windows[i] = Window2Left;
 				n_regions++;
 				break;
 			}
@@ -146,15 +151,15 @@ void S9xComputeClipWindows (void)
 
 		for (; i <= n_regions; i++)
 		{
-			if (PPU.Window2Right + 1 == windows[i])
+			if (Window2Right + 1 == windows[i])
 				break;
 
-			if (PPU.Window2Right + 1 <  windows[i])
+			if (Window2Right + 1 <  windows[i])
 			{
 				for (j = n_regions; j >= i; j--)
 					windows[j + 1] = windows[j];
 
-				windows[i] = PPU.Window2Right + 1;
+				windows[i] = Window2Right + 1;
 				n_regions++;
 				break;
 			}
@@ -165,19 +170,19 @@ void S9xComputeClipWindows (void)
 
 	uint8	W1, W2;
 
-	if (PPU.Window1Left <= PPU.Window1Right)
+	if (Window1Left <= Window1Right)
 	{
-		for (i = 0; windows[i] != PPU.Window1Left; i++) ;
-		for (j = i; windows[j] != PPU.Window1Right + 1; j++) ;
+		for (i = 0; windows[i] != Window1Left; i++) ;
+		for (j = i; windows[j] != Window1Right + 1; j++) ;
 		W1 = region_map[i][j];
 	}
 	else
 		W1 = 0;
 
-	if (PPU.Window2Left <= PPU.Window2Right)
+	if (Window2Left <= Window2Right)
 	{
-		for (i = 0; windows[i] != PPU.Window2Left; i++) ;
-		for (j = i; windows[j] != PPU.Window2Right + 1; j++) ;
+		for (i = 0; windows[i] != Window2Left; i++) ;
+		for (j = i; windows[j] != Window2Right + 1; j++) ;
 		W2 = region_map[i][j];
 	}
 	else
@@ -215,8 +220,8 @@ void S9xComputeClipWindows (void)
 
 	// Store backdrop clip window (draw everywhere color window allows)
 
-	StoreWindowRegions(0, &IPPU.Clip[0][5], n_regions, windows, drawing_modes, FALSE, TRUE);
-	StoreWindowRegions(0, &IPPU.Clip[1][5], n_regions, windows, drawing_modes, TRUE,  TRUE);
+	StoreWindowRegions(0, &Clip[0][5], n_regions, windows, drawing_modes, FALSE, TRUE);
+	StoreWindowRegions(0, &Clip[1][5], n_regions, windows, drawing_modes, TRUE,  TRUE);
 
 	// Store per-BG and OBJ clip windows
 
@@ -226,9 +231,40 @@ void S9xComputeClipWindows (void)
 		for (int sub = 0; sub < 2; sub++)
 		{
 			if (Memory.FillRAM[sub + 0x212e] & (1 << j))
-				StoreWindowRegions(W, &IPPU.Clip[sub][j], n_regions, windows, drawing_modes, sub);
+				StoreWindowRegions(W, &Clip[sub][j], n_regions, windows, drawing_modes, sub);
 			else
-				StoreWindowRegions(0, &IPPU.Clip[sub][j], n_regions, windows, drawing_modes, sub);
+				StoreWindowRegions(0, &Clip[sub][j], n_regions, windows, drawing_modes, sub);
 		}
 	}
 }
+
+void S9xComputeClipWindows (uint32 StartY, uint32 EndY)
+{
+	// Split StartY..EndY into runs of lines sharing the same window positions.
+	// WH0-WH3 are latched per line by RenderLine, so HDMA'd windows don't break
+	// up the lines being drawn; spans are only rebuilt where the positions move.
+
+	if (PPU.RecomputeClipWindows || memcmp(IPPU.ClipWindow, LineData[StartY].Window, 4))
+	{
+		memcpy(IPPU.ClipWindow, LineData[StartY].Window, 4);
+		ComputeClipSpans(IPPU.ClipWindow, IPPU.Clip[0]);
+		PPU.RecomputeClipWindows = FALSE;
+	}
+	else
+	if (IPPU.ClipRuns > 1)
+		memcpy(IPPU.Clip[0], IPPU.Clip[IPPU.ClipRuns - 1], sizeof(IPPU.Clip[0]));
+
+	IPPU.ClipRuns = 0;
+
+	for (uint32 Y = StartY + 1; Y <= EndY; Y++)
+	{
+		if (memcmp(IPPU.ClipWindow, LineData[Y].Window, 4))
+		{
+			IPPU.ClipRunEnd[IPPU.ClipRuns++] = Y - 1;
+			memcpy(IPPU.ClipWindow, LineData[Y].Window, 4);
+			ComputeClipSpans(IPPU.ClipWindow, IPPU.Clip[IPPU.ClipRuns]);
+		}
+	}
+
+	IPPU.ClipRunEnd[IPPU.ClipRuns++] = EndY;
+}
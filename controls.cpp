@@ -212,6 +212,7 @@ static const int	ptrspeeds[4] = { 1, 1, 4, 8 };
 	S(DecFrameRate), \
 	S(DecFrameTime), \
 	S(DecTurboSpeed), \
+	S(DumpProfile), \
 	S(EmuTurbo), \
 	S(EndRecordingMovie), \
 	S(ExitEmu), \
@@ -2185,6 +2186,13 @@ void S9xApplyCommand (s9xcommand_t cmd, int16 data1, int16 data2)
 					#endif
 						break;
 
+					case DumpProfile:
+					#ifdef PROFILER
+						if (S9xProfileDump(S9xGetFilenameInc(".prof.json", LOG_DIR)))
+							S9xSetInfoString("Profile dumped");
+					#endif
+						break;
+
 					case IncFrameRate:
 						if (Settings.SkipFrames == AUTO_FRAMERATE)
 							Settings.SkipFrames = 1;
@@ -81,6 +81,7 @@ static void S9xSoftResetCPU (void)
 	Timings.V_Max = Timings.V_Max_Master;
 	Timings.NMITriggerPos = 0xffff;
 	Timings.NextIRQTimer = 0x0fffffff;
+	Timings.NextInterrupt = 0x0fffffff;
 	Timings.IRQFlagChanging = IRQ_NONE;
 
 	if (Model->_5A22 == 2)
@@ -89,6 +90,8 @@ static void S9xSoftResetCPU (void)
 		Timings.WRAMRefreshPos = SNES_WRAM_REFRESH_HC_v1;
 
 	S9xSetPCBase(Registers.PBPC);
+	S9xResetBlockCache();
+	S9xResetIdleLoop();
 
 	ICPU.S9xOpcodes = S9xOpcodesE1;
 	ICPU.S9xOpLengths = S9xOpLengthsM1X1;
@@ -16,8 +16,85 @@
 #include "debug.h"
 #include "missing.h"
 #endif
+#ifdef CPU_VERIFY_BLOCKS
+#include "sa1.h"
+#include "fxinst.h"
+#include "controls.h"
+#endif
+
+#define BLOCK_CACHE_SIZE	2048
+#define BLOCK_CACHE_MASK	(BLOCK_CACHE_SIZE - 1)
+#define BLOCK_MAX_OPS		8
+
+// A straight run of opcodes starting at PBPC, decoded once for the opcode table (E/M/X mode) in effect.
+// Only code running from ROM is cached, so an entry stays valid until the ROM bytes or the mapping behind
+// PCBase change; operands are still fetched by the opcode handlers so the cycle accounting is untouched.
+struct SBlockCacheEntry
+{
+	uint8			*PCBase;
+	struct SOpcodes	*Opcodes;
+	uint32			Address;
+	uint32			NumOps;
+	void			(*S9xOpcode[BLOCK_MAX_OPS]) (void);
+};
+
+static struct SBlockCacheEntry	BlockCache[BLOCK_CACHE_SIZE];
+static bool8						BlockCacheInvalid = FALSE;	// set by S9xResetBlockCache, cleared once no block is running
+
+// Opcodes that can change PC, the E/M/X flags or the IRQ state, or that re-execute themselves.
+// They may start or end a block, but nothing is decoded past them.
+static const uint8	BlockEndOps[256] =
+{
+//  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
+	1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 1
+	1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, // 2
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 3
+	1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, // 4
+	1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, // 5
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, // 6
+	1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, // 7
+	1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 8
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 9
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // A
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // B
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, // C
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, // D
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // E
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0  // F
+};
+
+#define IDLE_LOOP_MAX_BYTES	16
+
+// The last short backward branch seen by S9xCheckIdleLoop and the CPU state when it was taken.
+static struct
+{
+	uint32	Address;
+	uint16	Target;
+	uint16	D;
+	uint16	P;
+	uint8	DB;
+	bool8	Safe;
+	bool8	Valid;
+	uint16	A;
+	uint16	X;
+	uint16	Y;
+	uint16	S;
+	uint8	_Carry;
+	uint8	_Zero;
+	uint8	_Negative;
+	uint8	_Overflow;
+	uint8	WhichEvent;
+	int32	V_Counter;
+	int32	Cycles;
+}	IdleLoop;
 
 static inline void S9xReschedule (void);
+#ifndef DEBUGGER
+static inline bool8 S9xBlockMustExit (void);
+static struct SBlockCacheEntry * S9xGetBlock (void);
+static void S9xExecuteBlock (struct SBlockCacheEntry *);
+#endif
 
 void S9xMainLoop (void)
 {
@@ -28,6 +105,7 @@ void S9xMainLoop (void)
 		{ \
 			CPU.NMIPending = TRUE; \
 			Timings.NMITriggerPos = CPU.Cycles + 6; \
+			S9xUpdateNextInterrupt(); \
 		} \
 		if (Timings.IRQFlagChanging & IRQ_CLEAR_FLAG) \
 			ClearIRQ(); \
@@ -44,38 +122,43 @@ void S9xMainLoop (void)
 
 	for (;;)
 	{
-		if (CPU.NMIPending)
+		// NMI and the H/V IRQ timer are the timed interrupt sources, only looked at once the earlier of them is due.
+		if (CPU.Cycles >= Timings.NextInterrupt)
 		{
-			#ifdef DEBUGGER
-			if (Settings.TraceHCEvent)
-			    S9xTraceFormattedMessage ("Comparing %d to %d\n", Timings.NMITriggerPos, CPU.Cycles);
-			#endif
-			if (Timings.NMITriggerPos <= CPU.Cycles)
+			if (CPU.NMIPending)
 			{
-				CPU.NMIPending = FALSE;
-				Timings.NMITriggerPos = 0xffff;
-				if (CPU.WaitingForInterrupt)
+				#ifdef DEBUGGER
+				if (Settings.TraceHCEvent)
+				    S9xTraceFormattedMessage ("Comparing %d to %d\n", Timings.NMITriggerPos, CPU.Cycles);
+				#endif
+				if (Timings.NMITriggerPos <= CPU.Cycles)
 				{
-					CPU.WaitingForInterrupt = FALSE;
-					Registers.PCw++;
-					CPU.Cycles += TWO_CYCLES + ONE_DOT_CYCLE / 2;
-					while (CPU.Cycles >= CPU.NextEvent)
-						S9xDoHEventProcessing();
-				}
+					CPU.NMIPending = FALSE;
+					Timings.NMITriggerPos = 0xffff;
+					S9xUpdateNextInterrupt();
+					if (CPU.WaitingForInterrupt)
+					{
+						CPU.WaitingForInterrupt = FALSE;
+						Registers.PCw++;
+						CPU.Cycles += TWO_CYCLES + ONE_DOT_CYCLE / 2;
+						while (CPU.Cycles >= CPU.NextEvent)
+							S9xDoHEventProcessing();
+					}
 
-				CHECK_FOR_IRQ_CHANGE();
-				S9xOpcode_NMI();
+					CHECK_FOR_IRQ_CHANGE();
+					S9xOpcode_NMI();
+				}
 			}
-		}
 
-		if (CPU.Cycles >= Timings.NextIRQTimer)
-		{
-			#ifdef DEBUGGER
-			S9xTraceMessage ("Timer triggered\n");
-			#endif
+			if (CPU.Cycles >= Timings.NextIRQTimer)
+			{
+				#ifdef DEBUGGER
+				S9xTraceMessage ("Timer triggered\n");
+				#endif
 
-			S9xUpdateIRQPositions(false);
-			CPU.IRQLine = TRUE;
+				S9xUpdateIRQPositions(false);
+				CPU.IRQLine = TRUE;
+			}
 		}
 
 		if (CPU.IRQLine || CPU.IRQExternal)
@@ -142,6 +225,21 @@ void S9xMainLoop (void)
 			break;
 		}
 
+	#ifndef DEBUGGER
+		if (CPU.PCBase && Memory.BlockIsROM[Registers.PBPC >> MEMMAP_SHIFT] && !Settings.DisableCPUBlockCache)
+		{
+			struct SBlockCacheEntry	*Block = S9xGetBlock();
+
+			if (Block)
+			{
+				S9xExecuteBlock(Block);
+				continue;
+			}
+		}
+	#endif
+
+		PROFILE_OP_START(Registers.PBPC, PROFILE_CPU_CYCLES());
+
 		uint8				Op;
 		struct	SOpcodes	*Opcodes;
 
@@ -162,7 +260,7 @@ void S9xMainLoop (void)
 		{
 			uint8	*oldPCBase = CPU.PCBase;
 
-			CPU.PCBase = S9xGetBasePointer(ICPU.ShiftedPB + ((uint16) (Registers.PCw + 4)));
+			CPU.PCBase = S9xGetPCBasePointer(ICPU.ShiftedPB + ((uint16) (Registers.PCw + 4)));
 			if (oldPCBase != CPU.PCBase || (Registers.PCw & ~MEMMAP_MASK) == (0xffff & ~MEMMAP_MASK))
 				Opcodes = S9xOpcodesSlow;
 		}
@@ -170,11 +268,394 @@ void S9xMainLoop (void)
 		Registers.PCw++;
 		(*Opcodes[Op].S9xOpcode)();
 
+		PROFILE_OP_END(PROFILE_CPU, Op, PROFILE_CPU_CYCLES());
+
 		if (Settings.SA1)
-			S9xSA1MainLoop();
+			S9xSA1Step();
+	}
+
+	S9xSA1CatchUp();
+	S9xPackStatus();
+}
+
+#ifndef DEBUGGER
+// Mirrors the checks at the top of S9xMainLoop: true if one of them would act before the next opcode.
+static inline bool8 S9xBlockMustExit (void)
+{
+	return (CPU.Cycles >= Timings.NextInterrupt ||
+			((CPU.IRQLine || CPU.IRQExternal) && !CheckFlag(IRQ)) ||
+			Timings.IRQFlagChanging ||
+			(CPU.Flags & SCAN_KEYS_FLAG) ||
+			BlockCacheInvalid);
+}
+
+static struct SBlockCacheEntry * S9xGetBlock (void)
+{
+	// Only ever called between blocks, so the entries can be dropped here.
+	if (BlockCacheInvalid)
+	{
+		memset(BlockCache, 0, sizeof(BlockCache));
+		BlockCacheInvalid = FALSE;
+	}
+
+	struct SBlockCacheEntry	*Block = &BlockCache[(Registers.PBPC ^ (Registers.PBPC >> 11)) & BLOCK_CACHE_MASK];
+
+	if (Block->Address == Registers.PBPC && Block->PCBase == CPU.PCBase && Block->Opcodes == ICPU.S9xOpcodes)
+		return (Block);
+
+	// Decode until a block-ending opcode or until an opcode gets near the end of the MEMMAP block,
+	// where S9xMainLoop has to re-check PCBase and may switch to S9xOpcodesSlow.
+	uint32	PC = Registers.PCw;
+	uint32	NumOps = 0;
+
+	while (NumOps < BLOCK_MAX_OPS)
+	{
+		uint8	Op = CPU.PCBase[PC];
+
+		if ((PC & MEMMAP_MASK) + ICPU.S9xOpLengths[Op] >= MEMMAP_BLOCK_SIZE)
+			break;
+
+		Block->S9xOpcode[NumOps++] = ICPU.S9xOpcodes[Op].S9xOpcode;
+		if (BlockEndOps[Op])
+			break;
+
+		PC += ICPU.S9xOpLengths[Op];
+	}
+
+	if (NumOps == 0)
+	{
+		Block->PCBase = NULL;
+		return (NULL);
+	}
+
+	Block->PCBase = CPU.PCBase;
+	Block->Opcodes = ICPU.S9xOpcodes;
+	Block->Address = Registers.PBPC;
+	Block->NumOps = NumOps;
+
+	return (Block);
+}
+
+#ifdef CPU_VERIFY_BLOCKS
+// Lockstep check against the interpreter. Everything an S-CPU opcode can change is saved, the opcode is run
+// the way S9xMainLoop would run it, and the state is put back so that the block can run the same opcode;
+// Registers and CPU.Cycles must then come out the same. An opcode that runs into event processing (line and
+// frame ends, HDMA) can't be taken back, so the interpreter's run stands and the block skips it.
+// Of the coprocessors only the SA-1 and SuperFX are saved. The APU isn't: its ports catch it up to the same
+// time on both runs.
+static struct
+{
+	struct SRegisters		Registers;
+	struct SICPU			ICPU;
+	struct SCPUState		CPU;
+	struct STimings			Timings;
+	struct SPPU				PPU;
+	struct InternalPPU		IPPU;
+	struct SDMA				DMA[8];
+	struct SSA1				SA1;
+	struct SSA1Registers	SA1Registers;
+	struct FxInfo_s			SuperFX;
+	struct FxRegs_s			GSU;
+	struct SControlSnapshot	Controls;
+	uint8					IdleLoopState[sizeof(IdleLoop)];
+	uint8					OpenBus;
+	uint8					WRAM[0x20000];
+	uint8					SRAM[0x80000];
+	uint8					FillRAM[0x8000];
+	uint8					VRAM[0x10000];
+}	Verify;
+
+static struct SRegisters	VerifyRegisters;
+static int32				VerifyCycles;
+
+static void S9xVerifySaveState (void)
+{
+	Verify.Registers = Registers;
+	Verify.ICPU = ICPU;
+	Verify.CPU = CPU;
+	Verify.Timings = Timings;
+	Verify.PPU = PPU;
+	Verify.IPPU = IPPU;
+	memcpy(Verify.DMA, DMA, sizeof(Verify.DMA));
+	Verify.SA1 = SA1;
+	Verify.SA1Registers = SA1Registers;
+	Verify.SuperFX = SuperFX;
+	Verify.GSU = GSU;
+	S9xControlPreSaveState(&Verify.Controls);
+	memcpy(Verify.IdleLoopState, &IdleLoop, sizeof(IdleLoop));
+	Verify.OpenBus = OpenBus;
+	memcpy(Verify.WRAM, Memory.RAM, sizeof(Verify.WRAM));
+	memcpy(Verify.SRAM, Memory.SRAM, sizeof(Verify.SRAM));
+	memcpy(Verify.FillRAM, Memory.FillRAM, sizeof(Verify.FillRAM));
+	memcpy(Verify.VRAM, Memory.VRAM, sizeof(Verify.VRAM));
+}
+
+static void S9xVerifyRestoreState (void)
+{
+	Registers = Verify.Registers;
+	ICPU = Verify.ICPU;
+	CPU = Verify.CPU;
+	Timings = Verify.Timings;
+	PPU = Verify.PPU;
+	IPPU = Verify.IPPU;
+	memcpy(DMA, Verify.DMA, sizeof(Verify.DMA));
+	SA1 = Verify.SA1;
+	SA1Registers = Verify.SA1Registers;
+	SuperFX = Verify.SuperFX;
+	GSU = Verify.GSU;
+	S9xControlPostLoadState(&Verify.Controls);
+	memcpy(&IdleLoop, Verify.IdleLoopState, sizeof(IdleLoop));
+	OpenBus = Verify.OpenBus;
+	memcpy(Memory.RAM, Verify.WRAM, sizeof(Verify.WRAM));
+	memcpy(Memory.SRAM, Verify.SRAM, sizeof(Verify.SRAM));
+	memcpy(Memory.FillRAM, Verify.FillRAM, sizeof(Verify.FillRAM));
+	memcpy(Memory.VRAM, Verify.VRAM, sizeof(Verify.VRAM));
+}
+
+static void S9xVerifyFailed (const char *what, uint32 Address, uint8 Op, uint32 i)
+{
+	char	buf[96];
+
+	snprintf(buf, sizeof(buf), "Block cache mismatch at %06X (op %02X, entry %d): %s", Address, Op, (int) i, what);
+	S9xMessage(S9X_FATAL_ERROR, S9X_DEBUG_OUTPUT, buf);
+	abort();
+}
+
+// Runs entry i of the block on the interpreter path and rewinds. Returns FALSE if the interpreter's run has
+// to stand, in which case the block must not run the opcode again.
+static bool8 S9xVerifyBlockOp (struct SBlockCacheEntry *Block, uint32 i)
+{
+	uint8	Op = CPU.PCBase[Registers.PCw];
+
+	if (CPU.PCBase != Block->PCBase || ICPU.S9xOpcodes != Block->Opcodes || ICPU.S9xOpcodes[Op].S9xOpcode != Block->S9xOpcode[i])
+		S9xVerifyFailed("stale entry", Registers.PBPC, Op, i);
+
+	S9xVerifySaveState();
+
+	struct	SOpcodes	*Opcodes = ICPU.S9xOpcodes;
+	int32				NextEvent = CPU.NextEvent;
+	uint8				WhichEvent = CPU.WhichEvent;
+	int32				V_Counter = CPU.V_Counter;
+	uint32				Frames = IPPU.TotalEmulatedFrames;
+
+	CPU.Cycles += CPU.MemSpeed;
+
+	if ((Registers.PCw & MEMMAP_MASK) + ICPU.S9xOpLengths[Op] >= MEMMAP_BLOCK_SIZE)
+	{
+		uint8	*oldPCBase = CPU.PCBase;
+
+		CPU.PCBase = S9xGetPCBasePointer(ICPU.ShiftedPB + ((uint16) (Registers.PCw + 4)));
+		if (oldPCBase != CPU.PCBase || (Registers.PCw & ~MEMMAP_MASK) == (0xffff & ~MEMMAP_MASK))
+			Opcodes = S9xOpcodesSlow;
 	}
 
+	Registers.PCw++;
+	(*Opcodes[Op].S9xOpcode)();
+
+	// A long DMA can go round a whole line and come back to the same event.
+	if (CPU.NextEvent != NextEvent || CPU.WhichEvent != WhichEvent || CPU.V_Counter != V_Counter || IPPU.TotalEmulatedFrames != Frames)
+		return (FALSE);
+
 	S9xPackStatus();
+	VerifyRegisters = Registers;
+	VerifyCycles = CPU.Cycles;
+
+	S9xVerifyRestoreState();
+
+	return (TRUE);
+}
+
+static void S9xVerifyBlockResult (uint32 i)
+{
+	uint32	Address = Verify.Registers.PBPC;
+	uint8	Op = Verify.CPU.PCBase[Verify.Registers.PCw];
+
+	S9xPackStatus();
+
+	if (Registers.PBPC != VerifyRegisters.PBPC)
+		S9xVerifyFailed("PC", Address, Op, i);
+	if (Registers.P.W != VerifyRegisters.P.W)
+		S9xVerifyFailed("P", Address, Op, i);
+	if (Registers.A.W != VerifyRegisters.A.W || Registers.X.W != VerifyRegisters.X.W || Registers.Y.W != VerifyRegisters.Y.W ||
+		Registers.S.W != VerifyRegisters.S.W || Registers.D.W != VerifyRegisters.D.W || Registers.DB != VerifyRegisters.DB)
+		S9xVerifyFailed("registers", Address, Op, i);
+	if (CPU.Cycles != VerifyCycles)
+		S9xVerifyFailed("cycles", Address, Op, i);
+}
+#endif
+
+static void S9xExecuteBlock (struct SBlockCacheEntry *Block)
+{
+	for (uint32 i = 0;;)
+	{
+	#ifdef PROFILER
+		uint8	Op = CPU.PCBase[Registers.PCw];
+	#endif
+		PROFILE_OP_START(Registers.PBPC, PROFILE_CPU_CYCLES());
+
+	#ifdef CPU_VERIFY_BLOCKS
+		if (S9xVerifyBlockOp(Block, i))
+	#endif
+		{
+			CPU.Cycles += CPU.MemSpeed;
+			Registers.PCw++;
+			(*Block->S9xOpcode[i])();
+		#ifdef CPU_VERIFY_BLOCKS
+			S9xVerifyBlockResult(i);
+		#endif
+		}
+
+		PROFILE_OP_END(PROFILE_CPU, Op, PROFILE_CPU_CYCLES());
+
+		if (Settings.SA1)
+			S9xSA1Step();
+
+		if (++i == Block->NumOps || S9xBlockMustExit())
+			break;
+	}
+}
+
+#endif
+
+void S9xResetBlockCache (void)
+{
+	// May be called from an opcode running out of a block: the running block
+	// stops at the next S9xBlockMustExit and the cache is cleared before reuse.
+	BlockCacheInvalid = TRUE;
+}
+
+static bool8 S9xIdleLoopReadIsSafe (uint32 Address)
+{
+	// Only memory that nothing but the CPU (and DMA/HDMA, which start from events) can change,
+	// and the registers that only change at an event. Both bytes are checked for 16-bit reads.
+	for (int i = 0; i < 2; i++, Address = (Address + 1) & 0xffffff)
+	{
+		uint8	bank = Address >> 16;
+		uint16	offset = Address & 0xffff;
+
+		if (bank == 0x7e || bank == 0x7f)
+			continue;
+
+		if (!(bank & 0x40) && (offset < 0x2000 || (offset >= 0x4210 && offset <= 0x4212)))
+			continue;
+
+		return (FALSE);
+	}
+
+	return (TRUE);
+}
+
+// True if every opcode between Target and the branch only reads registers or safe memory, so that an
+// iteration entered with the same CPU state repeats exactly until the next event.
+static bool8 S9xIsIdleLoop (uint16 Target)
+{
+	uint16	End = Registers.PCw - 2;
+	uint32	PC = Target;
+
+	if (!CPU.PCBase || Registers.PCw - Target > IDLE_LOOP_MAX_BYTES)
+		return (FALSE);
+
+	while (PC < End)
+	{
+		uint8	*p = CPU.PCBase + PC;
+
+		switch (*p)
+		{
+			// LDA, LDX, LDY, CMP, CPX, CPY, AND, ORA, EOR, BIT immediate
+			case 0xa9: case 0xa2: case 0xa0: case 0xc9: case 0xe0:
+			case 0xc0: case 0x29: case 0x09: case 0x49: case 0x89:
+			// NOP, CLC, SEC, CLV
+			case 0xea: case 0x18: case 0x38: case 0xb8:
+				break;
+
+			// direct
+			case 0xa5: case 0xa6: case 0xa4: case 0xc5: case 0xe4:
+			case 0xc4: case 0x25: case 0x05: case 0x45: case 0x24:
+				if (!S9xIdleLoopReadIsSafe((Registers.D.W + p[1]) & 0xffff))
+					return (FALSE);
+				break;
+
+			// absolute
+			case 0xad: case 0xae: case 0xac: case 0xcd: case 0xec:
+			case 0xcc: case 0x2d: case 0x0d: case 0x4d: case 0x2c:
+				if (!S9xIdleLoopReadIsSafe(ICPU.ShiftedDB | READ_WORD(p + 1)))
+					return (FALSE);
+				break;
+
+			// absolute long
+			case 0xaf: case 0xcf: case 0x2f: case 0x0f: case 0x4f:
+				if (!S9xIdleLoopReadIsSafe(READ_3WORD(p + 1)))
+					return (FALSE);
+				break;
+
+			default:
+				return (FALSE);
+		}
+
+		PC += ICPU.S9xOpLengths[*p];
+	}
+
+	return (PC == End);
+}
+
+// Called by a taken backward branch within the current MEMMAP block. Once a loop has gone round twice with
+// identical CPU state and no event in between, the iterations that would complete before the next event
+// are skipped by adding whole loop periods to CPU.Cycles, which leaves the emulated timing unchanged.
+void S9xCheckIdleLoop (uint16 Target)
+{
+	if (IdleLoop.Address != Registers.PBPC || IdleLoop.Target != Target ||
+		IdleLoop.D != Registers.D.W || IdleLoop.P != Registers.P.W || IdleLoop.DB != Registers.DB)
+	{
+		IdleLoop.Address = Registers.PBPC;
+		IdleLoop.Target = Target;
+		IdleLoop.D = Registers.D.W;
+		IdleLoop.P = Registers.P.W;
+		IdleLoop.DB = Registers.DB;
+		IdleLoop.Safe = S9xIsIdleLoop(Target);
+		IdleLoop.Valid = FALSE;
+	}
+
+	if (!IdleLoop.Safe)
+		return;
+
+	if (!IdleLoop.Valid ||
+		IdleLoop.A != Registers.A.W || IdleLoop.X != Registers.X.W || IdleLoop.Y != Registers.Y.W || IdleLoop.S != Registers.S.W ||
+		IdleLoop._Carry != ICPU._Carry || IdleLoop._Zero != ICPU._Zero ||
+		IdleLoop._Negative != ICPU._Negative || IdleLoop._Overflow != ICPU._Overflow ||
+		IdleLoop.WhichEvent != CPU.WhichEvent || IdleLoop.V_Counter != CPU.V_Counter)
+	{
+		IdleLoop.A = Registers.A.W;
+		IdleLoop.X = Registers.X.W;
+		IdleLoop.Y = Registers.Y.W;
+		IdleLoop.S = Registers.S.W;
+		IdleLoop._Carry = ICPU._Carry;
+		IdleLoop._Zero = ICPU._Zero;
+		IdleLoop._Negative = ICPU._Negative;
+		IdleLoop._Overflow = ICPU._Overflow;
+		IdleLoop.WhichEvent = CPU.WhichEvent;
+		IdleLoop.V_Counter = CPU.V_Counter;
+		IdleLoop.Cycles = CPU.Cycles;
+		IdleLoop.Valid = TRUE;
+		return;
+	}
+
+	int32	Period = CPU.Cycles - IdleLoop.Cycles;
+	int32	Next = CPU.NextEvent;
+
+	if (Timings.NextInterrupt < Next)
+		Next = Timings.NextInterrupt;
+	if (CPU.Cycles < Timings.HBlankEnd && Timings.HBlankEnd < Next)
+		Next = Timings.HBlankEnd;
+
+	if (Period > 0 && Next > CPU.Cycles && S9xIsIdleLoop(Target))
+		CPU.Cycles += (Next - 1 - CPU.Cycles) / Period * Period;
+
+	IdleLoop.Cycles = CPU.Cycles;
+}
+
+void S9xResetIdleLoop (void)
+{
+	memset(&IdleLoop, 0, sizeof(IdleLoop));
 }
 
 static inline void S9xReschedule (void)
@@ -234,6 +715,9 @@ void S9xDoHEventProcessing (void)
 			eventname[CPU.WhichEvent], CPU.NextEvent, CPU.Cycles, CPU.V_Counter);
 #endif
 
+	// HDMA and the end of line rebase need the SA-1 level with the S-CPU
+	S9xSA1CatchUp();
+
 	switch (CPU.WhichEvent)
 	{
 		case HC_HBLANK_START_EVENT:
@@ -263,10 +747,12 @@ void S9xDoHEventProcessing (void)
 
 			S9xAPUEndScanline();
 			CPU.Cycles -= Timings.H_Max;
+			PROFILE_CPU_REBASE(Timings.H_Max);
 			if (Timings.NMITriggerPos != 0xffff)
 				Timings.NMITriggerPos -= Timings.H_Max;
 			if (Timings.NextIRQTimer != 0x0fffffff)
 				Timings.NextIRQTimer -= Timings.H_Max;
+			S9xUpdateNextInterrupt();
 			S9xAPUSetReferenceTime(CPU.Cycles);
 
 			if (Settings.SA1)
@@ -326,6 +812,10 @@ void S9xDoHEventProcessing (void)
 
 			if (CPU.V_Counter == PPU.ScreenHeight + FIRST_VISIBLE_LINE)	// VBlank starts from V=225(240).
 			{
+				// Let the frame's sound be complete when the main loop returns
+				if (Settings.LazyAPUSync)
+					S9xAPUCatchUp();
+
 				S9xEndScreenRefresh();
 
 				CPU.Flags |= SCAN_KEYS_FLAG;
@@ -367,6 +857,7 @@ void S9xDoHEventProcessing (void)
 					// then, when to call S9xOpcode_NMI()?
 					CPU.NMIPending = TRUE;
 					Timings.NMITriggerPos = 6 + 6;
+					S9xUpdateNextInterrupt();
 				}
 
 			}
@@ -48,6 +48,9 @@ void S9xMainLoop (void);
 void S9xReset (void);
 void S9xSoftReset (void);
 void S9xDoHEventProcessing (void);
+void S9xResetBlockCache (void);
+void S9xCheckIdleLoop (uint16);
+void S9xResetIdleLoop (void);
 
 static inline void S9xUnpackStatus (void)
 {
@@ -63,6 +66,14 @@ static inline void S9xPackStatus (void)
 	Registers.PL |= ICPU._Carry | ((ICPU._Zero == 0) << 1) | (ICPU._Negative & 0x80) | (ICPU._Overflow << 6);
 }
 
+// Must be called whenever CPU.NMIPending, Timings.NMITriggerPos or Timings.NextIRQTimer changes.
+static inline void S9xUpdateNextInterrupt (void)
+{
+	Timings.NextInterrupt = Timings.NextIRQTimer;
+	if (CPU.NMIPending && Timings.NMITriggerPos < Timings.NextInterrupt)
+		Timings.NextInterrupt = Timings.NMITriggerPos;
+}
+
 static inline void S9xFixCycles (void)
 {
 	if (CheckEmulation())
@@ -108,7 +108,10 @@ static void Op##OP (void) \
 		if ((Registers.PCw & ~MEMMAP_MASK) != (newPC.W & ~MEMMAP_MASK)) \
 			S9xSetPCBase(ICPU.ShiftedPB + newPC.W); \
 		else \
+		{ \
+			CheckIdleLoop(newPC.W); \
 			Registers.PCw = newPC.W; \
+		} \
 	} \
 }
 
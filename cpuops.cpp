@@ -18,8 +18,10 @@
 
 #ifdef SA1_OPCODES
 #define AddCycles(n)	{ SA1.Cycles += (n); }
+#define CheckIdleLoop(pc)
 #else
 #define AddCycles(n)	{ CPU.Cycles += (n); while (CPU.Cycles >= CPU.NextEvent) S9xDoHEventProcessing(); }
+#define CheckIdleLoop(pc)	{ if (Settings.SkipIdleLoops && (pc) < Registers.PCw) S9xCheckIdleLoop(pc); }
 #endif
 
 #include "cpuaddr.h"
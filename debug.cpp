@@ -178,7 +178,6 @@ static uint8 S9xDebugGetByte (uint32 Address)
 	switch ((pint) GetAddress)
 	{
 		case CMemory::MAP_LOROM_SRAM:
-		case CMemory::MAP_SA1RAM:
 			byte = *(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask));
 			return (byte);
 
@@ -186,6 +185,10 @@ static uint8 S9xDebugGetByte (uint32 Address)
 			byte = *(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB));
 			return (byte);
 
+		case CMemory::MAP_SA1RAM:
+			byte = *S9xGetMemPointer(Address);
+			return (byte);
+
 		case CMemory::MAP_HIROM_SRAM:
 		case CMemory::MAP_RONLY_SRAM:
 			byte = *(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask));
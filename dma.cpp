@@ -51,6 +51,9 @@ static inline bool8 addCyclesInDMA (uint8 dma_channel)
 
 bool8 S9xDoDMA (uint8 Channel)
 {
+	// The transfer reaches I-RAM and BW-RAM through direct pointers
+	S9xSA1CatchUp();
+
 	CPU.InDMA = TRUE;
     CPU.InDMAorHDMA = TRUE;
 	CPU.CurrentDMAorHDMAChannel = Channel;
@@ -1105,6 +1108,7 @@ bool8 S9xDoDMA (uint8 Channel)
 	if (CPU.NMIPending && (Timings.NMITriggerPos != 0xffff))
 	{
 		Timings.NMITriggerPos = CPU.Cycles + Timings.NMIDMADelay;
+		S9xUpdateNextInterrupt();
 	}
 
 	// Release the memory used in SPC7110 DMA
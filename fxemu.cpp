@@ -213,6 +213,7 @@ static void FxReset (struct FxInfo_s *psFxInfo)
 	// Set pointer to GSU cache
 	GSU.pvCache = &GSU.pvRegisters[0x100];
 
+	fx_initOpcodeTable();
 	fx_readRegisterSpace();
 }
 
@@ -276,10 +277,11 @@ static void fx_readRegisterSpace (void)
 	GSU.pfPlot = fx_PlotTable[GSU.vMode];
 	GSU.pfRpix = fx_PlotTable[GSU.vMode + 5];
 
-	fx_OpcodeTable[0x04c] = GSU.pfPlot;
-	fx_OpcodeTable[0x14c] = GSU.pfRpix;
-	fx_OpcodeTable[0x24c] = GSU.pfPlot;
-	fx_OpcodeTable[0x34c] = GSU.pfRpix;
+	for (int i = 0; i < 0x800; i += 0x200)
+	{
+		fx_OpcodeTable[i | 0x04c] = GSU.pfPlot;
+		fx_OpcodeTable[i | 0x14c] = GSU.pfRpix;
+	}
 
 	fx_computeScreenPointers();
 
@@ -191,39 +191,25 @@ static void fx_bvs (void)
 }
 
 // 10-1f - to rn - set register n as destination register
-// 10-1f (B) - move rn - move one register to another (if B flag is set)
 #define FX_TO(reg) \
-	if (TF(B)) \
-	{ \
-		GSU.avReg[(reg)] = SREG; \
-		CLRFLAGS; \
-	} \
-	else \
-		GSU.pvDreg = &GSU.avReg[reg]; \
+	GSU.pvDreg = &GSU.avReg[reg]; \
 	R15++
 
-#define FX_TO_R14(reg) \
-	if (TF(B)) \
-	{ \
-		GSU.avReg[(reg)] = SREG; \
-		CLRFLAGS; \
-		READR14; \
-	} \
-	else \
-		GSU.pvDreg = &GSU.avReg[reg]; \
+// 10-1f (B) - move rn - move one register to another (if B flag is set)
+#define FX_MOVE(reg) \
+	GSU.avReg[(reg)] = SREG; \
+	CLRFLAGS; \
 	R15++
 
-#define FX_TO_R15(reg) \
-	if (TF(B)) \
-	{ \
-		GSU.avReg[(reg)] = SREG; \
-		CLRFLAGS; \
-	} \
-	else \
-	{ \
-		GSU.pvDreg = &GSU.avReg[reg]; \
-		R15++; \
-	}
+#define FX_MOVE_R14(reg) \
+	GSU.avReg[(reg)] = SREG; \
+	CLRFLAGS; \
+	READR14; \
+	R15++
+
+#define FX_MOVE_R15(reg) \
+	GSU.avReg[(reg)] = SREG; \
+	CLRFLAGS
 
 static void fx_to_r0 (void)
 {
@@ -297,12 +283,92 @@ static void fx_to_r13 (void)
 
 static void fx_to_r14 (void)
 {
-	FX_TO_R14(14);
+	FX_TO(14);
 }
 
 static void fx_to_r15 (void)
 {
-	FX_TO_R15(15);
+	FX_TO(15);
+}
+
+static void fx_move_r0 (void)
+{
+	FX_MOVE(0);
+}
+
+static void fx_move_r1 (void)
+{
+	FX_MOVE(1);
+}
+
+static void fx_move_r2 (void)
+{
+	FX_MOVE(2);
+}
+
+static void fx_move_r3 (void)
+{
+	FX_MOVE(3);
+}
+
+static void fx_move_r4 (void)
+{
+	FX_MOVE(4);
+}
+
+static void fx_move_r5 (void)
+{
+	FX_MOVE(5);
+}
+
+static void fx_move_r6 (void)
+{
+	FX_MOVE(6);
+}
+
+static void fx_move_r7 (void)
+{
+	FX_MOVE(7);
+}
+
+static void fx_move_r8 (void)
+{
+	FX_MOVE(8);
+}
+
+static void fx_move_r9 (void)
+{
+	FX_MOVE(9);
+}
+
+static void fx_move_r10 (void)
+{
+	FX_MOVE(10);
+}
+
+static void fx_move_r11 (void)
+{
+	FX_MOVE(11);
+}
+
+static void fx_move_r12 (void)
+{
+	FX_MOVE(12);
+}
+
+static void fx_move_r13 (void)
+{
+	FX_MOVE(13);
+}
+
+static void fx_move_r14 (void)
+{
+	FX_MOVE_R14(14);
+}
+
+static void fx_move_r15 (void)
+{
+	FX_MOVE_R15(15);
 }
 
 // 20-2f - to rn - set register n as source and destination register
@@ -703,13 +769,31 @@ static void fx_ldb_r11 (void)
 	FX_LDB(11);
 }
 
+// Both bitplanes of a pair sit next to each other, so plot sets the pixel in two planes with one 16-bit write.
+// The table gives the bytes of such a write for each 2-bit color value, in memory order.
+static const uint8	fx_PlanePairs[4][2] =
+{
+	{ 0x00, 0x00 }, { 0xff, 0x00 }, { 0x00, 0xff }, { 0xff, 0xff }
+};
+
+static inline void fx_plotPlanePair (uint8 *a, uint16 v, uint32 c)
+{
+	uint16	w, p;
+
+	memcpy(&w, a, 2);
+	memcpy(&p, fx_PlanePairs[c & 3], 2);
+	w = (w & ~v) | (p & v);
+	memcpy(a, &w, 2);
+}
+
 // 4c - plot - plot pixel with R1, R2 as x, y and the color register as the color
 static void fx_plot_2bit (void)
 {
 	uint32	x = USEX8(R1);
 	uint32	y = USEX8(R2);
 	uint8	*a;
-	uint8	v, c;
+	uint16	v;
+	uint8	c;
 
 	R15++;
 	CLRFLAGS;
@@ -729,17 +813,8 @@ static void fx_plot_2bit (void)
 		c = (uint8) GSU.vColorReg;
 
 	a = GSU.apvScreen[y >> 3] + GSU.x[x >> 3] + ((y & 7) << 1);
-	v = 128 >> (x & 7);
-
-	if (c & 0x01)
-		a[0] |=  v;
-	else
-		a[0] &= ~v;
-
-	if (c & 0x02)
-		a[1] |=  v;
-	else
-		a[1] &= ~v;
+	v = (128 >> (x & 7)) * 0x0101;
+	fx_plotPlanePair(a, v, c);
 }
 
 // 4c (ALT1) - rpix - read color of the pixel with R1, R2 as x, y
@@ -773,7 +848,8 @@ static void fx_plot_4bit (void)
 	uint32	x = USEX8(R1);
 	uint32	y = USEX8(R2);
 	uint8	*a;
-	uint8	v, c;
+	uint16	v;
+	uint8	c;
 
 	R15++;
 	CLRFLAGS;
@@ -793,27 +869,9 @@ static void fx_plot_4bit (void)
 		c = (uint8) GSU.vColorReg;
 
 	a = GSU.apvScreen[y >> 3] + GSU.x[x >> 3] + ((y & 7) << 1);
-	v = 128 >> (x & 7);
-
-	if (c & 0x01)
-		a[0x00] |=  v;
-	else
-		a[0x00] &= ~v;
-
-	if (c & 0x02)
-		a[0x01] |=  v;
-	else
-		a[0x01] &= ~v;
-
-	if (c & 0x04)
-		a[0x10] |=  v;
-	else
-		a[0x10] &= ~v;
-
-	if (c & 0x08)
-		a[0x11] |=  v;
-	else
-		a[0x11] &= ~v;
+	v = (128 >> (x & 7)) * 0x0101;
+	fx_plotPlanePair(a, v, c);
+	fx_plotPlanePair(a + 0x10, v, c >> 2);
 }
 
 // 4c (ALT1) - rpix - read color of the pixel with R1, R2 as x, y
@@ -849,7 +907,8 @@ static void fx_plot_8bit (void)
 	uint32	x = USEX8(R1);
 	uint32	y = USEX8(R2);
 	uint8	*a;
-	uint8	v, c;
+	uint16	v;
+	uint8	c;
 
 	R15++;
 	CLRFLAGS;
@@ -871,47 +930,11 @@ static void fx_plot_8bit (void)
 		return;
 
 	a = GSU.apvScreen[y >> 3] + GSU.x[x >> 3] + ((y & 7) << 1);
-	v = 128 >> (x & 7);
-
-	if (c & 0x01)
-		a[0x00] |=  v;
-	else
-		a[0x00] &= ~v;
-
-	if (c & 0x02)
-		a[0x01] |=  v;
-	else
-		a[0x01] &= ~v;
-
-	if (c & 0x04)
-		a[0x10] |=  v;
-	else
-		a[0x10] &= ~v;
-
-	if (c & 0x08)
-		a[0x11] |=  v;
-	else
-		a[0x11] &= ~v;
-
-	if (c & 0x10)
-		a[0x20] |=  v;
-	else
-		a[0x20] &= ~v;
-
-	if (c & 0x20)
-		a[0x21] |=  v;
-	else
-		a[0x21] &= ~v;
-
-	if (c & 0x40)
-		a[0x30] |=  v;
-	else
-		a[0x30] &= ~v;
-
-	if (c & 0x80)
-		a[0x31] |=  v;
-	else
-		a[0x31] &= ~v;
+	v = (128 >> (x & 7)) * 0x0101;
+	fx_plotPlanePair(a, v, c);
+	fx_plotPlanePair(a + 0x10, v, c >> 2);
+	fx_plotPlanePair(a + 0x20, v, c >> 4);
+	fx_plotPlanePair(a + 0x30, v, c >> 6);
 }
 
 // 4c (ALT1) - rpix - read color of the pixel with R1, R2 as x, y
@@ -2954,24 +2977,20 @@ static void fx_sms_r15 (void)
 }
 
 // b0-bf - from rn - set source register
-// b0-bf (B) - moves rn - move register to register, and set flags, (if B flag is set)
 #define FX_FROM(reg) \
-	if (TF(B)) \
-	{ \
-		uint32	v = GSU.avReg[reg]; \
-		R15++; \
-		DREG = v; \
-		GSU.vOverflow = (v & 0x80) << 16; \
-		GSU.vSign = v; \
-		GSU.vZero = v; \
-		TESTR14; \
-		CLRFLAGS; \
-	} \
-	else \
-	{ \
-		GSU.pvSreg = &GSU.avReg[reg]; \
-		R15++; \
-	}
+	GSU.pvSreg = &GSU.avReg[reg]; \
+	R15++
+
+// b0-bf (B) - moves rn - move register to register, and set flags, (if B flag is set)
+#define FX_MOVES(reg) \
+	uint32	v = GSU.avReg[reg]; \
+	R15++; \
+	DREG = v; \
+	GSU.vOverflow = (v & 0x80) << 16; \
+	GSU.vSign = v; \
+	GSU.vZero = v; \
+	TESTR14; \
+	CLRFLAGS
 
 static void fx_from_r0 (void)
 {
@@ -3053,6 +3072,86 @@ static void fx_from_r15 (void)
 	FX_FROM(15);
 }
 
+static void fx_moves_r0 (void)
+{
+	FX_MOVES(0);
+}
+
+static void fx_moves_r1 (void)
+{
+	FX_MOVES(1);
+}
+
+static void fx_moves_r2 (void)
+{
+	FX_MOVES(2);
+}
+
+static void fx_moves_r3 (void)
+{
+	FX_MOVES(3);
+}
+
+static void fx_moves_r4 (void)
+{
+	FX_MOVES(4);
+}
+
+static void fx_moves_r5 (void)
+{
+	FX_MOVES(5);
+}
+
+static void fx_moves_r6 (void)
+{
+	FX_MOVES(6);
+}
+
+static void fx_moves_r7 (void)
+{
+	FX_MOVES(7);
+}
+
+static void fx_moves_r8 (void)
+{
+	FX_MOVES(8);
+}
+
+static void fx_moves_r9 (void)
+{
+	FX_MOVES(9);
+}
+
+static void fx_moves_r10 (void)
+{
+	FX_MOVES(10);
+}
+
+static void fx_moves_r11 (void)
+{
+	FX_MOVES(11);
+}
+
+static void fx_moves_r12 (void)
+{
+	FX_MOVES(12);
+}
+
+static void fx_moves_r13 (void)
+{
+	FX_MOVES(13);
+}
+
+static void fx_moves_r14 (void)
+{
+	FX_MOVES(14);
+}
+
+static void fx_moves_r15 (void)
+{
+	FX_MOVES(15);
+}
+
 // c0 - hib - move high-byte to low-byte
 static void fx_hib (void)
 {
@@ -4043,8 +4142,9 @@ void (*fx_PlotTable[]) (void) =
 };
 
 // Opcode table
+// Indexed by the ALT1, ALT2 and B prefix flags and the opcode, see FX_STEP. The B half is filled in by fx_initOpcodeTable().
 
-void (*fx_OpcodeTable[]) (void) =
+void (*fx_OpcodeTable[0x800]) (void) =
 {
 	// ALT0 Table
 
@@ -4250,3 +4350,31 @@ void (*fx_OpcodeTable[]) (void) =
 	&fx_lm_r0,     &fx_lm_r1,     &fx_lm_r2,     &fx_lm_r3,     &fx_lm_r4,     &fx_lm_r5,     &fx_lm_r6,     &fx_lm_r7,
 	&fx_lm_r8,     &fx_lm_r9,     &fx_lm_r10,    &fx_lm_r11,    &fx_lm_r12,    &fx_lm_r13,    &fx_lm_r14,    &fx_lm_r15
 };
+
+void fx_initOpcodeTable (void)
+{
+	static void	(*moveTable[]) (void) =
+	{
+		&fx_move_r0,   &fx_move_r1,   &fx_move_r2,   &fx_move_r3,   &fx_move_r4,   &fx_move_r5,   &fx_move_r6,   &fx_move_r7,
+		&fx_move_r8,   &fx_move_r9,   &fx_move_r10,  &fx_move_r11,  &fx_move_r12,  &fx_move_r13,  &fx_move_r14,  &fx_move_r15
+	};
+
+	static void	(*movesTable[]) (void) =
+	{
+		&fx_moves_r0,  &fx_moves_r1,  &fx_moves_r2,  &fx_moves_r3,  &fx_moves_r4,  &fx_moves_r5,  &fx_moves_r6,  &fx_moves_r7,
+		&fx_moves_r8,  &fx_moves_r9,  &fx_moves_r10, &fx_moves_r11, &fx_moves_r12, &fx_moves_r13, &fx_moves_r14, &fx_moves_r15
+	};
+
+	// With B set (after WITH) only TO and FROM change meaning, into MOVE and MOVES.
+	// ALT1/ALT2 clear B, but WITH leaves them set, so all four ALT tables get a B copy.
+	memcpy(&fx_OpcodeTable[0x400], &fx_OpcodeTable[0x000], 0x400 * sizeof(fx_OpcodeTable[0]));
+
+	for (int i = 0x400; i < 0x800; i += 0x100)
+	{
+		for (int r = 0; r < 16; r++)
+		{
+			fx_OpcodeTable[i | 0x10 | r] = moveTable[r];
+			fx_OpcodeTable[i | 0xb0 | r] = movesTable[r];
+		}
+	}
+}
@@ -359,12 +359,14 @@ extern struct FxRegs_s	GSU;
 { \
 	uint32	vOpcode = (uint32) PIPE; \
 	FETCHPIPE; \
-	(*fx_OpcodeTable[(GSU.vStatusReg & 0x300) | vOpcode])(); \
+	(*fx_OpcodeTable[(GSU.vStatusReg & 0x300) | ((GSU.vStatusReg & FLG_B) >> 2) | vOpcode])(); \
 }
 
 extern void (*fx_PlotTable[]) (void);
 extern void (*fx_OpcodeTable[]) (void);
 
+void fx_initOpcodeTable (void);
+
 // Set this define if branches are relative to the instruction in the delay slot (I think they are)
 #define BRANCH_DELAY_RELATIVE
 
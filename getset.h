@@ -16,6 +16,7 @@
 #include "seta.h"
 #include "bsx.h"
 #include "msu1.h"
+#include "profile.h"
 
 #define addCyclesInMemoryAccess \
 	if (!CPU.InDMAorHDMA) \
@@ -54,6 +55,18 @@ static inline int32 memory_speed (uint32 address)
 	return (TWO_CYCLES);
 }
 
+// Accessors for blocks of Memory.Map / Memory.WriteMap that are not plain pointers, indexed by the CMemory::MAP_* value
+// stored for the block. Byte accessors leave the cycle accounting to the caller, word accessors do it themselves.
+typedef uint8	(*S9xGetByteHandler) (uint32);
+typedef uint16	(*S9xGetWordHandler) (uint32, int32);
+typedef void	(*S9xSetByteHandler) (uint8, uint32);
+typedef void	(*S9xSetWordHandler) (uint16, uint32, enum s9xwriteorder_t, int32);
+
+extern S9xGetByteHandler	S9xGetByteHandlers[CMemory::MAP_LAST];
+extern S9xGetWordHandler	S9xGetWordHandlers[CMemory::MAP_LAST];
+extern S9xSetByteHandler	S9xSetByteHandlers[CMemory::MAP_LAST];
+extern S9xSetWordHandler	S9xSetWordHandlers[CMemory::MAP_LAST];
+
 inline uint8 S9xGetByte (uint32 Address)
 {
 	int		block = (Address & 0xffffff) >> MEMMAP_SHIFT;
@@ -61,100 +74,15 @@ inline uint8 S9xGetByte (uint32 Address)
 	int32	speed = memory_speed(Address);
 	uint8	byte;
 
+	PROFILE_MAP_READ(GetAddress);
+
 	if (GetAddress >= (uint8 *) CMemory::MAP_LAST)
-	{
 		byte = *(GetAddress + (Address & 0xffff));
-		addCyclesInMemoryAccess;
-		return (byte);
-	}
-
-	switch ((pint) GetAddress)
-	{
-		case CMemory::MAP_CPU:
-			byte = S9xGetCPU(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_PPU:
-			if (CPU.InDMAorHDMA && (Address & 0xff00) == 0x2100)
-				return (OpenBus);
-
-			byte = S9xGetPPU(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_LOROM_SRAM:
-		case CMemory::MAP_SA1RAM:
-			// Address & 0x7fff   : offset into bank
-			// Address & 0xff0000 : bank
-			// bank >> 1 | offset : SRAM address, unbound
-			// unbound & SRAMMask : SRAM offset
-			byte = *(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask));
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_LOROM_SRAM_B:
-			byte = *(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB));
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_HIROM_SRAM:
-		case CMemory::MAP_RONLY_SRAM:
-			byte = *(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask));
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_BWRAM:
-			byte = *(Memory.BWRAM + ((Address & 0x7fff) - 0x6000));
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_DSP:
-			byte = S9xGetDSP(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return (byte);
+	else
+		byte = S9xGetByteHandlers[(pint) GetAddress](Address);
 
-		case CMemory::MAP_SPC7110_ROM:
-			byte = S9xGetSPC7110Byte(Address);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_SPC7110_DRAM:
-			byte = S9xGetSPC7110(0x4800);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_C4:
-			byte = S9xGetC4(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_OBC_RAM:
-			byte = S9xGetOBC1(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_SETA_DSP:
-			byte = S9xGetSetaDSP(Address);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_SETA_RISC:
-			byte = S9xGetST018(Address);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_BSX:
-			byte = S9xGetBSX(Address);
-			addCyclesInMemoryAccess;
-			return (byte);
-
-		case CMemory::MAP_NONE:
-		default:
-			byte = OpenBus;
-			addCyclesInMemoryAccess;
-			return (byte);
-	}
+	addCyclesInMemoryAccess;
+	return (byte);
 }
 
 inline uint16 S9xGetWord (uint32 Address, enum s9xwrap_t w = WRAP_NONE)
@@ -190,6 +118,8 @@ inline uint16 S9xGetWord (uint32 Address, enum s9xwrap_t w = WRAP_NONE)
 	uint8	*GetAddress = Memory.Map[block];
 	int32	speed = memory_speed(Address);
 
+	PROFILE_MAP_READ(GetAddress);
+
 	if (GetAddress >= (uint8 *) CMemory::MAP_LAST)
 	{
 		word = READ_WORD(GetAddress + (Address & 0xffff));
@@ -197,124 +127,7 @@ inline uint16 S9xGetWord (uint32 Address, enum s9xwrap_t w = WRAP_NONE)
 		return (word);
 	}
 
-	switch ((pint) GetAddress)
-	{
-		case CMemory::MAP_CPU:
-			word  = S9xGetCPU(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			word |= S9xGetCPU((Address + 1) & 0xffff) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_PPU:
-			if (CPU.InDMAorHDMA)
-			{
-				word = OpenBus = S9xGetByte(Address);
-				return (word | (S9xGetByte(Address + 1) << 8));
-			}
-
-			word  = S9xGetPPU(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			word |= S9xGetPPU((Address + 1) & 0xffff) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_LOROM_SRAM:
-		case CMemory::MAP_SA1RAM:
-			if (Memory.SRAMMask >= MEMMAP_MASK)
-				word = READ_WORD(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask));
-			else
-				word = (*(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask))) |
-					  ((*(Memory.SRAM + (((((Address + 1) & 0xff0000) >> 1) | ((Address + 1) & 0x7fff)) & Memory.SRAMMask))) << 8);
-			addCyclesInMemoryAccess_x2;
-			return (word);
-
-		case CMemory::MAP_LOROM_SRAM_B:
-			if (Multi.sramMaskB >= MEMMAP_MASK)
-				word = READ_WORD(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB));
-			else
-				word = (*(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB))) |
-					  ((*(Multi.sramB + (((((Address + 1) & 0xff0000) >> 1) | ((Address + 1) & 0x7fff)) & Multi.sramMaskB))) << 8);
-			addCyclesInMemoryAccess_x2;
-			return (word);
-
-		case CMemory::MAP_HIROM_SRAM:
-		case CMemory::MAP_RONLY_SRAM:
-			if (Memory.SRAMMask >= MEMMAP_MASK)
-				word = READ_WORD(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask));
-			else
-				word = (*(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask)) |
-					   (*(Memory.SRAM + ((((Address + 1) & 0x7fff) - 0x6000 + (((Address + 1) & 0xf0000) >> 3)) & Memory.SRAMMask)) << 8));
-			addCyclesInMemoryAccess_x2;
-			return (word);
-
-		case CMemory::MAP_BWRAM:
-			word = READ_WORD(Memory.BWRAM + ((Address & 0x7fff) - 0x6000));
-			addCyclesInMemoryAccess_x2;
-			return (word);
-
-		case CMemory::MAP_DSP:
-			word  = S9xGetDSP(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			word |= S9xGetDSP((Address + 1) & 0xffff) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_SPC7110_ROM:
-			word  = S9xGetSPC7110Byte(Address);
-			addCyclesInMemoryAccess;
-			word |= S9xGetSPC7110Byte(Address + 1) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_SPC7110_DRAM:
-			word  = S9xGetSPC7110(0x4800);
-			addCyclesInMemoryAccess;
-			word |= S9xGetSPC7110(0x4800) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_C4:
-			word  = S9xGetC4(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			word |= S9xGetC4((Address + 1) & 0xffff) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_OBC_RAM:
-			word  = S9xGetOBC1(Address & 0xffff);
-			addCyclesInMemoryAccess;
-			word |= S9xGetOBC1((Address + 1) & 0xffff) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_SETA_DSP:
-			word  = S9xGetSetaDSP(Address);
-			addCyclesInMemoryAccess;
-			word |= S9xGetSetaDSP(Address + 1) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_SETA_RISC:
-			word  = S9xGetST018(Address);
-			addCyclesInMemoryAccess;
-			word |= S9xGetST018(Address + 1) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_BSX:
-			word  = S9xGetBSX(Address);
-			addCyclesInMemoryAccess;
-			word |= S9xGetBSX(Address + 1) << 8;
-			addCyclesInMemoryAccess;
-			return (word);
-
-		case CMemory::MAP_NONE:
-		default:
-			word = OpenBus | (OpenBus << 8);
-			addCyclesInMemoryAccess_x2;
-			return (word);
-	}
+	return (S9xGetWordHandlers[(pint) GetAddress](Address, speed));
 }
 
 inline void S9xSetByte (uint8 Byte, uint32 Address)
@@ -323,104 +136,14 @@ inline void S9xSetByte (uint8 Byte, uint32 Address)
 	uint8	*SetAddress = Memory.WriteMap[block];
 	int32	speed = memory_speed(Address);
 
+	PROFILE_MAP_WRITE(SetAddress);
+
 	if (SetAddress >= (uint8 *) CMemory::MAP_LAST)
-	{
 		*(SetAddress + (Address & 0xffff)) = Byte;
-		addCyclesInMemoryAccess;
-		return;
-	}
+	else
+		S9xSetByteHandlers[(pint) SetAddress](Byte, Address);
 
-	switch ((pint) SetAddress)
-	{
-		case CMemory::MAP_CPU:
-			S9xSetCPU(Byte, Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_PPU:
-			if (CPU.InDMAorHDMA && (Address & 0xff00) == 0x2100)
-				return;
-
-			S9xSetPPU(Byte, Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_LOROM_SRAM:
-			if (Memory.SRAMMask)
-			{
-				*(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask)) = Byte;
-				CPU.SRAMModified = TRUE;
-			}
-
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_LOROM_SRAM_B:
-			if (Multi.sramMaskB)
-			{
-				*(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB)) = Byte;
-				CPU.SRAMModified = TRUE;
-			}
-
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_HIROM_SRAM:
-			if (Memory.SRAMMask)
-			{
-				*(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask)) = Byte;
-				CPU.SRAMModified = TRUE;
-			}
-
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_BWRAM:
-			*(Memory.BWRAM + ((Address & 0x7fff) - 0x6000)) = Byte;
-			CPU.SRAMModified = TRUE;
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_SA1RAM:
-			*(Memory.SRAM + (Address & 0xffff)) = Byte;
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_DSP:
-			S9xSetDSP(Byte, Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_C4:
-			S9xSetC4(Byte, Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_OBC_RAM:
-			S9xSetOBC1(Byte, Address & 0xffff);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_SETA_DSP:
-			S9xSetSetaDSP(Byte, Address);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_SETA_RISC:
-			S9xSetST018(Byte, Address);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_BSX:
-			S9xSetBSX(Byte, Address);
-			addCyclesInMemoryAccess;
-			return;
-
-		case CMemory::MAP_NONE:
-		default:
-			addCyclesInMemoryAccess;
-			return;
-	}
+	addCyclesInMemoryAccess;
 }
 
 inline void S9xSetWord (uint16 Word, uint32 Address, enum s9xwrap_t w = WRAP_NONE, enum s9xwriteorder_t o = WRITE_01)
@@ -463,6 +186,8 @@ inline void S9xSetWord (uint16 Word, uint32 Address, enum s9xwrap_t w = WRAP_NON
 	uint8	*SetAddress = Memory.WriteMap[block];
 	int32	speed = memory_speed(Address);
 
+	PROFILE_MAP_WRITE(SetAddress);
+
 	if (SetAddress >= (uint8 *) CMemory::MAP_LAST)
 	{
 		WRITE_WORD(SetAddress + (Address & 0xffff), Word);
@@ -470,228 +195,7 @@ inline void S9xSetWord (uint16 Word, uint32 Address, enum s9xwrap_t w = WRAP_NON
 		return;
 	}
 
-	switch ((pint) SetAddress)
-	{
-		case CMemory::MAP_CPU:
-			if (o)
-			{
-				S9xSetCPU(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetCPU((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetCPU((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetCPU(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_PPU:
-			if (CPU.InDMAorHDMA)
-			{
-				if ((Address & 0xff00) != 0x2100)
-					S9xSetPPU((uint8) Word, Address & 0xffff);
-				if (((Address + 1) & 0xff00) != 0x2100)
-					S9xSetPPU(Word >> 8, (Address + 1) & 0xffff);
-				return;
-			}
-
-			if (o)
-			{
-				S9xSetPPU(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetPPU((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetPPU((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetPPU(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_LOROM_SRAM:
-			if (Memory.SRAMMask)
-			{
-				if (Memory.SRAMMask >= MEMMAP_MASK)
-					WRITE_WORD(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask), Word);
-				else
-				{
-					*(Memory.SRAM + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Memory.SRAMMask)) = (uint8) Word;
-					*(Memory.SRAM + (((((Address + 1) & 0xff0000) >> 1) | ((Address + 1) & 0x7fff)) & Memory.SRAMMask)) = Word >> 8;
-				}
-
-				CPU.SRAMModified = TRUE;
-			}
-
-			addCyclesInMemoryAccess_x2;
-			return;
-
-		case CMemory::MAP_LOROM_SRAM_B:
-			if (Multi.sramMaskB)
-			{
-				if (Multi.sramMaskB >= MEMMAP_MASK)
-					WRITE_WORD(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB), Word);
-				else
-				{
-					*(Multi.sramB + ((((Address & 0xff0000) >> 1) | (Address & 0x7fff)) & Multi.sramMaskB)) = (uint8) Word;
-					*(Multi.sramB + (((((Address + 1) & 0xff0000) >> 1) | ((Address + 1) & 0x7fff)) & Multi.sramMaskB)) = Word >> 8;
-				}
-
-				CPU.SRAMModified = TRUE;
-			}
-
-			addCyclesInMemoryAccess_x2;
-			return;
-
-		case CMemory::MAP_HIROM_SRAM:
-			if (Memory.SRAMMask)
-			{
-				if (Memory.SRAMMask >= MEMMAP_MASK)
-					WRITE_WORD(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask), Word);
-				else
-				{
-					*(Memory.SRAM + (((Address & 0x7fff) - 0x6000 + ((Address & 0xf0000) >> 3)) & Memory.SRAMMask)) = (uint8) Word;
-					*(Memory.SRAM + ((((Address + 1) & 0x7fff) - 0x6000 + (((Address + 1) & 0xf0000) >> 3)) & Memory.SRAMMask)) = Word >> 8;
-				}
-
-				CPU.SRAMModified = TRUE;
-			}
-
-			addCyclesInMemoryAccess_x2;
-			return;
-
-		case CMemory::MAP_BWRAM:
-			WRITE_WORD(Memory.BWRAM + ((Address & 0x7fff) - 0x6000), Word);
-			CPU.SRAMModified = TRUE;
-			addCyclesInMemoryAccess_x2;
-			return;
-
-		case CMemory::MAP_SA1RAM:
-			WRITE_WORD(Memory.SRAM + (Address & 0xffff), Word);
-			addCyclesInMemoryAccess_x2;
-			return;
-
-		case CMemory::MAP_DSP:
-			if (o)
-			{
-				S9xSetDSP(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetDSP((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetDSP((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetDSP(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_C4:
-			if (o)
-			{
-				S9xSetC4(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetC4((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetC4((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetC4(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_OBC_RAM:
-			if (o)
-			{
-				S9xSetOBC1(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetOBC1((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetOBC1((uint8) Word, Address & 0xffff);
-				addCyclesInMemoryAccess;
-				S9xSetOBC1(Word >> 8, (Address + 1) & 0xffff);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_SETA_DSP:
-			if (o)
-			{
-				S9xSetSetaDSP(Word >> 8, Address + 1);
-				addCyclesInMemoryAccess;
-				S9xSetSetaDSP((uint8) Word, Address);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetSetaDSP((uint8) Word, Address);
-				addCyclesInMemoryAccess;
-				S9xSetSetaDSP(Word >> 8, Address + 1);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_SETA_RISC:
-			if (o)
-			{
-				S9xSetST018(Word >> 8, Address + 1);
-				addCyclesInMemoryAccess;
-				S9xSetST018((uint8) Word, Address);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetST018((uint8) Word, Address);
-				addCyclesInMemoryAccess;
-				S9xSetST018(Word >> 8, Address + 1);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_BSX:
-			if (o)
-			{
-				S9xSetBSX(Word >> 8, Address + 1);
-				addCyclesInMemoryAccess;
-				S9xSetBSX((uint8) Word, Address);
-				addCyclesInMemoryAccess;
-				return;
-			}
-			else
-			{
-				S9xSetBSX((uint8) Word, Address);
-				addCyclesInMemoryAccess;
-				S9xSetBSX(Word >> 8, Address + 1);
-				addCyclesInMemoryAccess;
-				return;
-			}
-
-		case CMemory::MAP_NONE:
-		default:
-			addCyclesInMemoryAccess_x2;
-			return;
-	}
+	S9xSetWordHandlers[(pint) SetAddress](Word, Address, o, speed);
 }
 
 inline void S9xSetPCBase (uint32 Address)
@@ -734,11 +238,17 @@ inline void S9xSetPCBase (uint32 Address)
 			return;
 
 		case CMemory::MAP_BWRAM:
-			CPU.PCBase = Memory.BWRAM - 0x6000 - (Address & 0x8000);
+			if (Settings.BatchSA1)
+				CPU.PCBase = NULL; // fetch through BWRAM_GetByte, which catches up the SA-1
+			else
+				CPU.PCBase = Memory.BWRAM - 0x6000 - (Address & 0x8000);
 			return;
 
 		case CMemory::MAP_SA1RAM:
-			CPU.PCBase = Memory.SRAM;
+			if (Settings.BatchSA1)
+				CPU.PCBase = NULL; // fetch through SA1RAM_GetByte, which catches up the SA-1
+			else
+				CPU.PCBase = (Address & 0x400000) ? Memory.SRAM + (Address & 0x30000) : Memory.FillRAM;
 			return;
 
 		case CMemory::MAP_SPC7110_ROM:
@@ -792,7 +302,7 @@ inline uint8 * S9xGetBasePointer (uint32 Address)
 			return (Memory.BWRAM - 0x6000 - (Address & 0x8000));
 
 		case CMemory::MAP_SA1RAM:
-			return (Memory.SRAM);
+			return ((Address & 0x400000) ? Memory.SRAM + (Address & 0x30000) : Memory.FillRAM);
 
 		case CMemory::MAP_SPC7110_ROM:
 			return (S9xGetBasePointerSPC7110(Address));
@@ -809,6 +319,20 @@ inline uint8 * S9xGetBasePointer (uint32 Address)
 	}
 }
 
+// Like S9xGetBasePointer, but for opcode fetches: with SA-1 batching, code in I-RAM or BW-RAM is fetched
+// through the memory handlers so that the SA-1 is caught up first, as S9xSetPCBase does.
+inline uint8 * S9xGetPCBasePointer (uint32 Address)
+{
+	if (Settings.BatchSA1)
+	{
+		pint	GetAddress = (pint) Memory.Map[(Address & 0xffffff) >> MEMMAP_SHIFT];
+		if (GetAddress == CMemory::MAP_BWRAM || GetAddress == CMemory::MAP_SA1RAM)
+			return (NULL);
+	}
+
+	return (S9xGetBasePointer(Address));
+}
+
 inline uint8 * S9xGetMemPointer (uint32 Address)
 {
 	uint8	*GetAddress = Memory.Map[(Address & 0xffffff) >> MEMMAP_SHIFT];
@@ -837,7 +361,7 @@ inline uint8 * S9xGetMemPointer (uint32 Address)
 			return (Memory.BWRAM - 0x6000 + (Address & 0x7fff));
 
 		case CMemory::MAP_SA1RAM:
-			return (Memory.SRAM + (Address & 0xffff));
+			return (((Address & 0x400000) ? Memory.SRAM + (Address & 0x30000) : Memory.FillRAM) + (Address & 0xffff));
 
 		case CMemory::MAP_SPC7110_ROM:
 			return (S9xGetBasePointerSPC7110(Address) + (Address & 0xffff));
@@ -19,7 +19,7 @@ extern struct SCheatData		Cheat;
 extern struct SLineData			LineData[240];
 extern struct SLineMatrixData	LineMatrixData[240];
 
-void S9xComputeClipWindows (void);
+void S9xComputeClipWindows (uint32, uint32);
 
 static int	font_width = 8, font_height = 9;
 void (*S9xCustomDisplayString) (const char *, int, int, bool, int) = NULL;
@@ -38,6 +38,7 @@ static void DrawBackgroundOffsetMosaic (int, uint8, uint8, int);
 static inline void DrawBackgroundMode7 (int, void (*DrawMath) (uint32, uint32, int), void (*DrawNomath) (uint32, uint32, int), int);
 static inline void DrawBackdrop (void);
 static inline void RenderScreen (bool8);
+static void FindChangedLines (int, int);
 static uint16 get_crosshair_color (uint8);
 static void S9xDisplayStringType (const char *, int, int, bool, int);
 
@@ -213,6 +214,7 @@ void S9xEndScreenRefresh (void)
 		if (GFX.DoInterlace && GFX.InterlaceFrame == 0)
 		{
 			S9xControlEOF();
+			FindChangedLines(IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight);
 			S9xContinueUpdate(IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight);
 		}
 		else
@@ -232,6 +234,7 @@ void S9xEndScreenRefresh (void)
 			if (Settings.AutoDisplayMessages)
 				S9xDisplayMessages(GFX.Screen, GFX.RealPPL, IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight, 1);
 
+			FindChangedLines(IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight);
 			S9xDeinitUpdate(IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight);
 		}
 	}
@@ -304,6 +307,11 @@ void RenderLine (uint8 C)
 			LineData[C].BG[3].HOffset = PPU.BG[3].HOffset;
 		}
 
+		LineData[C].Window[0] = PPU.Window1Left;
+		LineData[C].Window[1] = PPU.Window1Right;
+		LineData[C].Window[2] = PPU.Window2Left;
+		LineData[C].Window[3] = PPU.Window2Right;
+
 		IPPU.CurrentLine = C + 1;
 	}
 	else
@@ -321,13 +329,15 @@ static inline void RenderScreen (bool8 sub)
 	uint8	BGActive;
 	int		D;
 
+	uint32	StartY = GFX.StartY;
+	uint32	EndY = GFX.EndY;
+
 	if (!sub)
 	{
 		GFX.S = GFX.Screen;
 		if (GFX.DoInterlace && GFX.InterlaceFrame)
 			GFX.S += GFX.RealPPL;
 		GFX.DB = GFX.ZBuffer;
-		GFX.Clip = IPPU.Clip[0];
 		BGActive = Memory.FillRAM[0x212c] & ~Settings.BG_Forced;
 		D = 32;
 	}
@@ -335,11 +345,21 @@ static inline void RenderScreen (bool8 sub)
 	{
 		GFX.S = GFX.SubScreen;
 		GFX.DB = GFX.SubZBuffer;
-		GFX.Clip = IPPU.Clip[1];
 		BGActive = Memory.FillRAM[0x212d] & ~Settings.BG_Forced;
 		D = (Memory.FillRAM[0x2130] & 2) << 4; // 'do math' depth flag
 	}
 
+	// Each layer is set up once, then drawn over every window run with that
+	// run's clip spans.
+	#define FOR_EACH_CLIP_RUN(draw) \
+		for (int run = 0; run < IPPU.ClipRuns; run++) \
+		{ \
+			GFX.StartY = run ? IPPU.ClipRunEnd[run - 1] + 1 : StartY; \
+			GFX.EndY = IPPU.ClipRunEnd[run]; \
+			GFX.Clip = IPPU.Clip[run][sub]; \
+			draw; \
+		}
+
 	if (BGActive & 0x10)
 	{
 		BG.TileAddress = PPU.OBJNameBase;
@@ -348,7 +368,7 @@ static inline void RenderScreen (bool8 sub)
 		BG.StartPalette = 128;
 		S9xSelectTileConverter(4, FALSE, sub, FALSE);
 		S9xSelectTileRenderers(PPU.BGMode, sub, TRUE);
-		DrawOBJS(D + 4);
+		FOR_EACH_CLIP_RUN(DrawOBJS(D + 4));
 	}
 
 	BG.NameSelect = 0;
@@ -369,16 +389,16 @@ static inline void RenderScreen (bool8 sub)
 				BG.OffsetSizeV = (PPU.BG[2].BGSize) ? 16 : 8; \
 				\
 				if (PPU.BGMosaic[n] && (hires || PPU.Mosaic > 1)) \
-					DrawBackgroundOffsetMosaic(n, D + Zh, D + Zl, voffoff); \
+					FOR_EACH_CLIP_RUN(DrawBackgroundOffsetMosaic(n, D + Zh, D + Zl, voffoff)) \
 				else \
-					DrawBackgroundOffset(n, D + Zh, D + Zl, voffoff); \
+					FOR_EACH_CLIP_RUN(DrawBackgroundOffset(n, D + Zh, D + Zl, voffoff)) \
 			} \
 			else \
 			{ \
 				if (PPU.BGMosaic[n] && (hires || PPU.Mosaic > 1)) \
-					DrawBackgroundMosaic(n, D + Zh, D + Zl); \
+					FOR_EACH_CLIP_RUN(DrawBackgroundMosaic(n, D + Zh, D + Zl)) \
 				else \
-					DrawBackground(n, D + Zh, D + Zl); \
+					FOR_EACH_CLIP_RUN(DrawBackground(n, D + Zh, D + Zl)) \
 			} \
 		}
 
@@ -425,13 +445,13 @@ static inline void RenderScreen (bool8 sub)
 			if (BGActive & 0x01)
 			{
 				BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 1);
-				DrawBackgroundMode7(0, GFX.DrawMode7BG1Math, GFX.DrawMode7BG1Nomath, D);
+				FOR_EACH_CLIP_RUN(DrawBackgroundMode7(0, GFX.DrawMode7BG1Math, GFX.DrawMode7BG1Nomath, D));
 			}
 
 			if ((Memory.FillRAM[0x2133] & 0x40) && (BGActive & 0x02))
 			{
 				BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 2);
-				DrawBackgroundMode7(1, GFX.DrawMode7BG2Math, GFX.DrawMode7BG2Nomath, D);
+				FOR_EACH_CLIP_RUN(DrawBackgroundMode7(1, GFX.DrawMode7BG2Math, GFX.DrawMode7BG2Nomath, D));
 			}
 
 			break;
@@ -441,7 +461,12 @@ static inline void RenderScreen (bool8 sub)
 
 	BG.EnableMath = !sub && (Memory.FillRAM[0x2131] & 0x20);
 
-	DrawBackdrop();
+	FOR_EACH_CLIP_RUN(DrawBackdrop());
+
+	#undef FOR_EACH_CLIP_RUN
+
+	GFX.StartY = StartY;
+	GFX.EndY = EndY;
 }
 
 void S9xUpdateScreen (void)
@@ -456,16 +481,17 @@ void S9xUpdateScreen (void)
 	if ((GFX.EndY = IPPU.CurrentLine - 1) >= PPU.ScreenHeight)
 		GFX.EndY = PPU.ScreenHeight - 1;
 
+	uint32	FirstLine = GFX.StartY;
+
 	if (!PPU.ForcedBlanking)
 	{
 		// If force blank, may as well completely skip all this. We only did
 		// the OBJ because (AFAWK) the RTO flags are updated even during force-blank.
 
-		if (PPU.RecomputeClipWindows)
-		{
-			S9xComputeClipWindows();
-			PPU.RecomputeClipWindows = FALSE;
-		}
+		S9xComputeClipWindows(GFX.StartY, GFX.EndY);
+
+		if (IPPU.VRAMChanged)
+			S9xFlushTileCaches();
 
 		if (Settings.SupportHiRes)
 		{
@@ -504,6 +530,7 @@ void S9xUpdateScreen (void)
 
 				IPPU.DoubleWidthPixels = TRUE;
 				IPPU.RenderedScreenWidth = 512;
+				FirstLine = 0;
 			}
 
 			if (!IPPU.DoubleHeightPixels && IPPU.Interlace && (PPU.BGMode == 5 || PPU.BGMode == 6))
@@ -515,6 +542,8 @@ void S9xUpdateScreen (void)
 
 				for (int32 y = (int32) GFX.StartY - 2; y >= 0; y--)
 					memmove(GFX.Screen + (y + 1) * GFX.PPL, GFX.Screen + y * GFX.RealPPL, GFX.PPL * sizeof(uint16));
+
+				FirstLine = 0;
 			}
 		}
 
@@ -542,9 +571,56 @@ void S9xUpdateScreen (void)
 				GFX.S[x] = black;
 	}
 
+	if (GFX.Screen32)
+	{
+		uint32	rows = GFX.PPL / GFX.RealPPL;
+		S9xUpdateScreen32(FirstLine * rows, (GFX.EndY + 1) * rows);
+	}
+
 	IPPU.PreviousLine = IPPU.CurrentLine;
 }
 
+// Which sprites are on which lines for the normal priority case, kept from
+// one SetupOBJ to the next along with what the lines were built from.
+static struct
+{
+	bool8	Valid;
+	uint8	SizeSelect;
+	uint8	StartLine;
+	uint8	Inc;
+	uint8	FirstSprite;
+	int		SpriteLimit;
+	int		MaxTiles;
+	struct SOBJ	OBJ[128];
+	uint32	OnLine[SNES_HEIGHT_EXTENDED][4];
+	uint8	RTOFlags[SNES_HEIGHT_EXTENDED];		// flags raised on the line itself
+}	OBJIndex;
+
+static void IndexOBJLines (int S, bool8 add, int Width, int Height, int startline, int inc, uint32 *LineDirty)
+{
+	int	HPos = OBJIndex.OBJ[S].HPos;
+	if (HPos == -256)
+		HPos = 0;
+
+	if (HPos <= -Width || HPos > 256)
+		return;
+
+	uint32	bit = (uint32) 1 << (S & 31);
+
+	for (uint8 line = startline, Y = (uint8) (OBJIndex.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
+	{
+		if (Y >= SNES_HEIGHT_EXTENDED)
+			continue;
+
+		if (add)
+			OBJIndex.OnLine[Y][S >> 5] |= bit;
+		else
+			OBJIndex.OnLine[Y][S >> 5] &= ~bit;
+
+		LineDirty[Y >> 5] |= (uint32) 1 << (Y & 31);
+	}
+}
+
 static void SetupOBJ (void)
 {
 	int	SmallWidth, SmallHeight, LargeWidth, LargeHeight;
@@ -607,23 +683,48 @@ static void SetupOBJ (void)
 
 	if (!PPU.OAMPriorityRotation || !(PPU.OAMFlip & PPU.OAMAddr & 1)) // normal case
 	{
-		uint8	LineOBJ[SNES_HEIGHT_EXTENDED];
-		memset(LineOBJ, 0, sizeof(LineOBJ));
+		// Only the lines of sprites that moved, resized, flipped or changed
+		// visibility since the last call are listed again. Anything else that
+		// changes the lists starts over from scratch.
+		uint32	LineDirty[(SNES_HEIGHT_EXTENDED + 31) / 32];
+		memset(LineDirty, 0, sizeof(LineDirty));
+
+		bool8	rebuild = !OBJIndex.Valid ||
+			OBJIndex.SizeSelect != PPU.OBJSizeSelect || OBJIndex.StartLine != startline || OBJIndex.Inc != inc ||
+			OBJIndex.FirstSprite != PPU.FirstSprite || OBJIndex.SpriteLimit != sprite_limit || OBJIndex.MaxTiles != Settings.MaxSpriteTilesPerLine;
 
-		for (int i = 0; i < SNES_HEIGHT_EXTENDED; i++)
+		if (rebuild)
 		{
-			GFX.OBJLines[i].RTOFlags = 0;
-			GFX.OBJLines[i].Tiles = Settings.MaxSpriteTilesPerLine;
-			for (int j = 0; j < sprite_limit; j++)
-				GFX.OBJLines[i].OBJ[j].Sprite = -1;
+			memset(OBJIndex.OnLine, 0, sizeof(OBJIndex.OnLine));
+			memset(LineDirty, 0xff, sizeof(LineDirty));
+
+			OBJIndex.Valid       = TRUE;
+			OBJIndex.SizeSelect  = PPU.OBJSizeSelect;
+			OBJIndex.StartLine   = startline;
+			OBJIndex.Inc         = inc;
+			OBJIndex.FirstSprite = PPU.FirstSprite;
+			OBJIndex.SpriteLimit = sprite_limit;
+			OBJIndex.MaxTiles    = Settings.MaxSpriteTilesPerLine;
 		}
 
-		uint8	FirstSprite = PPU.FirstSprite;
-		S = FirstSprite;
-
-		do
+		for (S = 0; S < 128; S++)
 		{
-			if (PPU.OBJ[S].Size)
+			struct SOBJ	*old = &OBJIndex.OBJ[S], *obj = &PPU.OBJ[S];
+
+			if (!rebuild)
+			{
+				if (old->HPos == obj->HPos && old->VPos == obj->VPos && old->Size == obj->Size && old->VFlip == obj->VFlip)
+					continue;
+
+				if (old->Size)
+					IndexOBJLines(S, FALSE, LargeWidth, LargeHeight, startline, inc, LineDirty);
+				else
+					IndexOBJLines(S, FALSE, SmallWidth, SmallHeight, startline, inc, LineDirty);
+			}
+
+			*old = *obj;
+
+			if (obj->Size)
 			{
 				GFX.OBJWidths[S] = LargeWidth;
 				Height = LargeHeight;
@@ -634,7 +735,7 @@ static void SetupOBJ (void)
 				Height = SmallHeight;
 			}
 
-			int	HPos = PPU.OBJ[S].HPos;
+			int	HPos = obj->HPos;
 			if (HPos == -256)
 				HPos = 0;
 
@@ -648,38 +749,73 @@ static void SetupOBJ (void)
 				else
 					GFX.OBJVisibleTiles[S] = GFX.OBJWidths[S] >> 3;
 
-				for (uint8 line = startline, Y = (uint8) (PPU.OBJ[S].VPos & 0xff); line < Height; Y++, line += inc)
-				{
-					if (Y >= SNES_HEIGHT_EXTENDED)
-						continue;
+				IndexOBJLines(S, TRUE, GFX.OBJWidths[S], Height, startline, inc, LineDirty);
+			}
+		}
 
-					if (LineOBJ[Y] >= sprite_limit)
-					{
-						GFX.OBJLines[Y].RTOFlags |= 0x40;
-						continue;
-					}
+		bool8	changed = FALSE;
 
-					GFX.OBJLines[Y].Tiles -= GFX.OBJVisibleTiles[S];
-					if (GFX.OBJLines[Y].Tiles < 0)
-						GFX.OBJLines[Y].RTOFlags |= 0x80;
+		for (int Y = 0; Y < SNES_HEIGHT_EXTENDED; Y++)
+		{
+			if (!(LineDirty[Y >> 5] & ((uint32) 1 << (Y & 31))))
+				continue;
 
-					GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Sprite = S;
-					if (PPU.OBJ[S].VFlip)
-						// Yes, Width not Height. It so happens that the
-						// sprites with H=2*W flip as two WxW sprites.
-						GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Line = line ^ (GFX.OBJWidths[S] - 1);
-					else
-						GFX.OBJLines[Y].OBJ[LineOBJ[Y]].Line = line;
+			changed = TRUE;
+
+			uint8	RTOFlags = 0;
+			int		j = 0;
 
-					LineOBJ[Y]++;
+			GFX.OBJLines[Y].Tiles = Settings.MaxSpriteTilesPerLine;
+
+			// In priority order, starting from FirstSprite
+			for (int n = 0; n < 128; )
+			{
+				S = (PPU.FirstSprite + n) & 0x7f;
+
+				uint32	bits = OBJIndex.OnLine[Y][S >> 5] >> (S & 31);
+				if (!bits)
+				{
+					n += 32 - (S & 31);
+					continue;
+				}
+
+				n++;
+				if (!(bits & 1))
+					continue;
+
+				if (j >= sprite_limit)
+				{
+					RTOFlags |= 0x40;
+					continue;
 				}
+
+				GFX.OBJLines[Y].Tiles -= GFX.OBJVisibleTiles[S];
+				if (GFX.OBJLines[Y].Tiles < 0)
+					RTOFlags |= 0x80;
+
+				uint8	line = startline + (uint8) (Y - PPU.OBJ[S].VPos) * inc;
+
+				GFX.OBJLines[Y].OBJ[j].Sprite = S;
+				if (PPU.OBJ[S].VFlip)
+					// Yes, Width not Height. It so happens that the
+					// sprites with H=2*W flip as two WxW sprites.
+					GFX.OBJLines[Y].OBJ[j++].Line = line ^ (GFX.OBJWidths[S] - 1);
+				else
+					GFX.OBJLines[Y].OBJ[j++].Line = line;
 			}
 
-			S = (S + 1) & 0x7f;
-		} while (S != FirstSprite);
+			if (j < sprite_limit)
+				GFX.OBJLines[Y].OBJ[j].Sprite = -1;
 
-		for (int Y = 1; Y < SNES_HEIGHT_EXTENDED; Y++)
-			GFX.OBJLines[Y].RTOFlags |= GFX.OBJLines[Y - 1].RTOFlags;
+			OBJIndex.RTOFlags[Y] = RTOFlags;
+		}
+
+		if (changed)
+		{
+			GFX.OBJLines[0].RTOFlags = OBJIndex.RTOFlags[0];
+			for (int Y = 1; Y < SNES_HEIGHT_EXTENDED; Y++)
+				GFX.OBJLines[Y].RTOFlags = OBJIndex.RTOFlags[Y] | GFX.OBJLines[Y - 1].RTOFlags;
+		}
 	}
 	else // evil FirstSprite+Y case
 	{
@@ -777,6 +913,8 @@ static void SetupOBJ (void)
 			if (j < sprite_limit)
 				GFX.OBJLines[Y].OBJ[j].Sprite = -1;
 		}
+
+		OBJIndex.Valid = FALSE;
 	}
 
 	IPPU.OBJChanged = FALSE;
@@ -1750,12 +1888,97 @@ static inline void DrawBackdrop (void)
 	}
 }
 
+void S9xUpdateScreen32 (uint32 first, uint32 end)
+{
+	// Expand the 5-bit channels to the full 8-bit range for rows [first, end).
+	// X is set, so the rows can also be uploaded as opaque BGRA.
+	uint32	width = IPPU.RenderedScreenWidth;
+
+	if (end > GFX.ScreenSize / GFX.RealPPL)
+		end = GFX.ScreenSize / GFX.RealPPL;
+
+	for (uint32 y = first; y < end; y++)
+	{
+		uint16	*s = GFX.Screen   + y * GFX.RealPPL;
+		uint32	*d = GFX.Screen32 + y * GFX.RealPPL;
+
+		for (uint32 x = 0; x < width; x++)
+		{
+			uint32	r, g, b;
+
+			DECOMPOSE_PIXEL(s[x], r, g, b);
+			r = (r << 3) | (r >> 2);
+			g = (g << 3) | (g >> 2);
+			b = (b << 3) | (b >> 2);
+			d[x] = 0xff000000 | (r << 16) | (g << 8) | b;
+		}
+	}
+}
+
+// Rows of the frame last handed to the port that differ from the one before,
+// found against the port's GFX.LastScreen copy once the frame is complete.
+static struct
+{
+	uint32	Bits[(MAX_SNES_HEIGHT + 31) / 32];
+	int		Count;
+	int		Width;
+	int		Height;
+	uint16	*Buffer;
+}	LineChanges;
+
+static void FindChangedLines (int width, int height)
+{
+	if (!GFX.LastScreen)
+		return;
+
+	// A new size or buffer means nothing from the previous frame can be kept.
+	bool8	all = (width != LineChanges.Width || height != LineChanges.Height || GFX.LastScreen != LineChanges.Buffer);
+
+	LineChanges.Width  = width;
+	LineChanges.Height = height;
+	LineChanges.Buffer = GFX.LastScreen;
+	LineChanges.Count  = 0;
+	memset(LineChanges.Bits, 0, sizeof(LineChanges.Bits));
+
+	for (int y = 0; y < height; y++)
+	{
+		uint16	*s = GFX.Screen     + y * GFX.RealPPL;
+		uint16	*d = GFX.LastScreen + y * GFX.RealPPL;
+
+		if (all || memcmp(s, d, width * sizeof(uint16)))
+		{
+			memcpy(d, s, width * sizeof(uint16));
+			LineChanges.Bits[y >> 5] |= (uint32) 1 << (y & 31);
+			LineChanges.Count++;
+		}
+	}
+}
+
+bool8 S9xLineChanged (int y)
+{
+	if (!GFX.LastScreen || y < 0 || y >= LineChanges.Height)
+		return (TRUE);
+
+	return ((LineChanges.Bits[y >> 5] >> (y & 31)) & 1);
+}
+
+int S9xChangedLines (void)
+{
+	if (!GFX.LastScreen)
+		return (IPPU.RenderedScreenHeight);
+
+	return (LineChanges.Count);
+}
+
 void S9xReRefresh (void)
 {
 	// Be careful when calling this function from the thread other than the emulation one...
 	// Here it's assumed no drawing occurs from the emulation thread when Settings.Paused is TRUE.
 	if (Settings.Paused)
+	{
+		FindChangedLines(IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight);
 		S9xDeinitUpdate(IPPU.RenderedScreenWidth, IPPU.RenderedScreenHeight);
+	}
 }
 
 void S9xSetInfoString (const char *string)
@@ -1801,7 +2024,9 @@ static void DisplayStringFromBottom (const char *string, int linesFromBottom, in
 	if (linesFromBottom <= 0)
 		linesFromBottom = 1;
 
-	uint16	*dst = GFX.Screen + (IPPU.RenderedScreenHeight - font_height * linesFromBottom) * GFX.RealPPL + pixelsFromLeft;
+	int		first_row = IPPU.RenderedScreenHeight - font_height * linesFromBottom;
+	uint16	*dst = GFX.Screen + first_row * GFX.RealPPL + pixelsFromLeft;
+	uint16	*last = NULL;
 
 	int	len = strlen(string);
 	int	max_chars = IPPU.RenderedScreenWidth / (font_width - 1);
@@ -1825,8 +2050,18 @@ static void DisplayStringFromBottom (const char *string, int linesFromBottom, in
 			continue;
 
 		S9xDisplayChar(dst, string[i]);
+		last = dst;
 		dst += font_width - 1;
 	}
+
+	// Bring the rows under the whole string over to Screen32 in one pass.
+	if (GFX.Screen32 && last)
+	{
+		int	end_row = (int) ((last - GFX.Screen) / GFX.RealPPL) + font_height;
+
+		if (end_row > 0)
+			S9xUpdateScreen32(first_row < 0 ? 0 : first_row, end_row);
+	}
 }
 
 static void S9xDisplayStringType (const char *string, int linesFromBottom, int pixelsFromLeft, bool allowWrap, int type)
@@ -2141,5 +2376,8 @@ void S9xDrawCrosshair (const char *crosshair, uint8 fgcolor, uint8 bgcolor, int1
 				*s = (bgcolor & 0x10) ? COLOR_ADD::fn1_2(*s, bg) : bg;
 		}
 	}
+
+	if (GFX.Screen32 && y + r > 0)
+		S9xUpdateScreen32(y < 0 ? 0 : y, y + r);
 }
 
@@ -12,6 +12,8 @@
 struct SGFX
 {
 	uint16	*Screen;
+	uint32	*Screen32;			// optional XRGB8888 copy of Screen, same layout, kept up to date line by line
+	uint16	*LastScreen;		// optional copy of the last frame shown, same layout as Screen, for S9xLineChanged
 	uint16	*SubScreen;
 	uint8	*ZBuffer;
 	uint8	*SubZBuffer;
@@ -102,6 +104,7 @@ struct SLineData
 		uint16	VOffset;
 		uint16	HOffset;
 	}	BG[4];
+	uint8	Window[4];	// WH0-WH3
 };
 
 struct SLineMatrixData
@@ -203,11 +206,16 @@ void S9xStartScreenRefresh (void);
 void S9xEndScreenRefresh (void);
 void S9xBuildDirectColourMaps (void);
 void RenderLine (uint8);
-void S9xComputeClipWindows (void);
+void S9xComputeClipWindows (uint32, uint32);
 void S9xDisplayChar (uint16 *, uint8);
 void S9xGraphicsScreenResize (void);
 // called automatically unless Settings.AutoDisplayMessages is false
 void S9xDisplayMessages (uint16 *, int, int, int, int);
+// with GFX.LastScreen set, which rows of the frame passed to S9xDeinitUpdate differ from the previous one
+bool8 S9xLineChanged (int);
+int S9xChangedLines (void);
+// with GFX.Screen32 set, refreshes its rows [first, end) after GFX.Screen was written outside the renderer
+void S9xUpdateScreen32 (uint32, uint32);
 
 // external port interface which must be implemented or initialised for each port
 bool8 S9xGraphicsInit (void);
@@ -180,10 +180,14 @@ int Snes9xConfig::load_defaults()
     Settings.SupportHiRes = true;
     Settings.FrameTime = Settings.FrameTimeNTSC;
     Settings.BlockInvalidVRAMAccessMaster = true;
+    Settings.SkipIdleLoopsMaster = true;
+    Settings.BatchSA1Master = false;
     Settings.SoundSync = false;
+    Settings.LazyAPUSync = false;
     Settings.DynamicRateControl = false;
     Settings.DynamicRateLimit = 5;
     Settings.InterpolationMethod = DSP_INTERPOLATION_GAUSSIAN;
+    Settings.ResamplerQuality = 0;
     Settings.HDMATimingHack = 100;
     Settings.SuperFXClockMultiplier = 100;
     Settings.NetPlay = false;
@@ -294,6 +298,7 @@ int Snes9xConfig::save_config_file()
     outint("InputRate", sound_input_rate);
     outbool("DynamicRateControl", Settings.DynamicRateControl);
     outint("DynamicRateControlLimit", Settings.DynamicRateLimit);
+    outint("ResamplerQuality", Settings.ResamplerQuality, "0: Hermite, 1: Sinc (16 taps), 2: Sinc (32 taps), 3: Sinc (64 taps)");
     outbool("AutomaticInputRate", auto_input_rate, "Guess input rate by asking the monitor what its refresh rate is");
     outint("PlaybackRate", gui_config->sound_playback_rate, "1: 8000Hz, 2: 11025Hz, 3: 16000Hz, 4: 22050Hz, 5: 32000Hz, 6: 44100Hz, 7: 48000Hz");
 
@@ -528,6 +533,7 @@ int Snes9xConfig::load_config_file()
     inint("InputRate", sound_input_rate);
     inbool("DynamicRateControl", Settings.DynamicRateControl);
     inint("DynamicRateControlLimit", Settings.DynamicRateLimit);
+    inint("ResamplerQuality", Settings.ResamplerQuality);
     inbool("AutomaticInputRate", auto_input_rate);
     inint("PlaybackRate", gui_config->sound_playback_rate);
 
@@ -661,6 +667,8 @@ int Snes9xConfig::load_config_file()
     Settings.SeparateEchoBuffer = false;
     Settings.InterpolationMethod = 2;
     Settings.BlockInvalidVRAMAccessMaster = true;
+    Settings.SkipIdleLoopsMaster = true;
+    Settings.BatchSA1Master = false;
 #endif
 
     if (default_esc_behavior != ESC_TOGGLE_MENUBAR)
@@ -35,6 +35,7 @@ static GThreadPool *pool;
 static uint8 *y_table, *u_table, *v_table;
 static int endianess = ENDIAN_NORMAL;
 static std::vector<uint8_t> scaled_image;
+static uint32_t screen32_buffer[512 * 1024];
 
 /* Scanline constants for the NTSC filter */
 static const unsigned int scanline_offsets[] = {
@@ -1330,6 +1331,11 @@ bool8 S9xDeinitUpdate(int width, int height)
         memset(GFX.Screen + (GFX.Pitch >> 1) * height,
                0,
                GFX.Pitch * (top_level->last_height - height));
+
+        if (GFX.Screen32)
+            memset(GFX.Screen32 + (GFX.Pitch >> 1) * height,
+                   0,
+                   GFX.Pitch * 2 * (top_level->last_height - height));
     }
 
     top_level->last_height = height;
@@ -1397,6 +1403,14 @@ bool8 S9xDeinitUpdate(int width, int height)
         return true;
     }
 
+    /* Unfiltered frames straight from the core are already in 32 bits */
+    if (GFX.Screen32 && gui_config->rom_loaded && gui_config->hires_effect == HIRES_NORMAL)
+    {
+        driver->update32(GFX.Screen32 + yoffset * 512, width, height, 512);
+
+        return true;
+    }
+
     driver->update(screen_view, width, height, 512);
 
     return true;
@@ -1446,6 +1460,8 @@ static void S9xInitDriver()
         }
     }
 
+    GFX.Screen32 = driver->uses_screen32() ? &screen32_buffer[512 * 256] : NULL;
+
     pool = NULL;
 }
 
@@ -1484,6 +1500,9 @@ void S9xReinitDisplay()
 
     memmove(GFX.Screen, buffer, 512 * 478 * 2);
 
+    if (GFX.Screen32)
+        S9xUpdateScreen32(0, 478);
+
     delete[] buffer;
 }
 
@@ -1592,6 +1611,7 @@ static void S9xGTKDisplayString(const char *string, int linesFromBottom,
     else if (gui_config->overscan)
         dst_y += 8;
 
+    int first_y = dst_y;
     int overlap = 0;
 
     for (int i = 0; i < len; i++)
@@ -1620,6 +1640,9 @@ static void S9xGTKDisplayString(const char *string, int linesFromBottom,
         dst_x += char_width - 1;
         overlap = 1;
     }
+
+    if (GFX.Screen32 && dst_y + font_height > 0)
+        S9xUpdateScreen32(first_y < 0 ? 0 : first_y, dst_y + font_height);
 }
 
 void S9xInitDisplay(int argc, char **argv)
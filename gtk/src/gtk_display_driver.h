@@ -19,6 +19,8 @@ class S9xDisplayDriver
     virtual int init() = 0;
     virtual void deinit() = 0;
     virtual void update(uint16_t *buffer, int width, int height, int stride_in_pixels) = 0;
+    virtual void update32(uint32_t *buffer, int width, int height, int stride_in_pixels) = 0;
+    virtual bool uses_screen32() = 0;
     virtual void *get_parameters() = 0;
     virtual void save(const char *filename) = 0;
     virtual bool is_ready() = 0;
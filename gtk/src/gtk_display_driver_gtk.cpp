@@ -23,10 +23,19 @@ void S9xGTKDisplayDriver::update(uint16_t *buffer, int width, int height, int st
     if (width <= 0)
         return;
     S9xRect dst = S9xApplyAspect(width, height, drawing_area->get_width(), drawing_area->get_height());
-    output(buffer, stride_in_pixels * 2, dst.x, dst.y, width, height, dst.w, dst.h);
+    output(buffer, CAIRO_FORMAT_RGB16_565, stride_in_pixels * 2, dst.x, dst.y, width, height, dst.w, dst.h);
+}
+
+void S9xGTKDisplayDriver::update32(uint32_t *buffer, int width, int height, int stride_in_pixels)
+{
+    if (width <= 0)
+        return;
+    S9xRect dst = S9xApplyAspect(width, height, drawing_area->get_width(), drawing_area->get_height());
+    output(buffer, CAIRO_FORMAT_RGB24, stride_in_pixels * 4, dst.x, dst.y, width, height, dst.w, dst.h);
 }
 
 void S9xGTKDisplayDriver::output(void *src,
+                                 cairo_format_t format,
                                  int src_pitch,
                                  int x,
                                  int y,
@@ -46,7 +55,7 @@ void S9xGTKDisplayDriver::output(void *src,
     cairo_t *cr = window->get_cairo();
     cairo_surface_t *surface;
 
-    surface = cairo_image_surface_create_for_data((unsigned char *)src, CAIRO_FORMAT_RGB16_565, width, height, src_pitch);
+    surface = cairo_image_surface_create_for_data((unsigned char *)src, format, width, height, src_pitch);
 
     cairo_set_source_surface(cr, surface, 0, 0);
 
@@ -18,6 +18,11 @@ class S9xGTKDisplayDriver : public S9xDisplayDriver
     int init();
     void deinit();
     void update(uint16_t *buffer, int width, int height, int stride_in_pixels);
+    void update32(uint32_t *buffer, int width, int height, int stride_in_pixels);
+    bool uses_screen32()
+    {
+        return true;
+    }
     void *get_parameters()
     {
         return NULL;
@@ -33,6 +38,7 @@ class S9xGTKDisplayDriver : public S9xDisplayDriver
   private:
     void clear();
     void output(void *src,
+                cairo_format_t format,
                 int src_pitch,
                 int x,
                 int y,
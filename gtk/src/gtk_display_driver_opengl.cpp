@@ -90,6 +90,23 @@ S9xOpenGLDisplayDriver::S9xOpenGLDisplayDriver(Snes9xWindow *window, Snes9xConfi
 
 void S9xOpenGLDisplayDriver::update(uint16_t *buffer, int width, int height, int stride_in_pixels)
 {
+    output(buffer, 16, width, height, stride_in_pixels);
+}
+
+void S9xOpenGLDisplayDriver::update32(uint32_t *buffer, int width, int height, int stride_in_pixels)
+{
+    output(buffer, 32, width, height, stride_in_pixels);
+}
+
+bool S9xOpenGLDisplayDriver::uses_screen32()
+{
+    return using_pbos && config->pbo_format == 32;
+}
+
+void S9xOpenGLDisplayDriver::output(void *data, int bpp, int width, int height, int stride_in_pixels)
+{
+    uint16_t *buffer = (uint16_t *)data;
+
     Gtk::Allocation allocation = drawing_area->get_allocation();
 
     if (output_window_width != allocation.get_width() ||
@@ -121,7 +138,41 @@ void S9xOpenGLDisplayDriver::update(uint16_t *buffer, int width, int height, int
 
     update_texture_size(width, height);
 
-    if (using_pbos)
+    if (bpp == 32)
+    {
+        /* Already XRGB8888 from the core, so rows go up as they are */
+        uint32_t *src = (uint32_t *)data;
+
+        if (using_pbos)
+        {
+            void *pbo_memory = NULL;
+            GLbitfield bits = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, width * height * 4, NULL, GL_STREAM_DRAW);
+
+            if (version >= 30)
+                pbo_memory = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, width * height * 4, bits);
+            else
+                pbo_memory = glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+
+            for (int y = 0; y < height; y++)
+                memcpy((uint32_t *)pbo_memory + (width * y), &src[y * stride_in_pixels], width * 4);
+
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, BUFFER_OFFSET(0));
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        else
+        {
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, stride_in_pixels);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, src);
+        }
+    }
+    else if (using_pbos)
     {
         void *pbo_memory = NULL;
         GLbitfield bits = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
@@ -34,6 +34,8 @@ class S9xOpenGLDisplayDriver : public S9xDisplayDriver
     int init();
     void deinit();
     void update(uint16_t *buffer, int width, int height, int stride_in_pixels);
+    void update32(uint32_t *buffer, int width, int height, int stride_in_pixels);
+    bool uses_screen32();
     void *get_parameters();
     void save(const char *filename);
     static int query_availability();
@@ -46,6 +48,7 @@ class S9xOpenGLDisplayDriver : public S9xDisplayDriver
     void update_texture_size(int width, int height);
     bool create_context();
     void resize();
+    void output(void *data, int bpp, int width, int height, int stride_in_pixels);
 
     GLuint stock_program;
     GLuint coord_buffer;
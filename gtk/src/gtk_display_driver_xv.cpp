@@ -75,6 +75,30 @@ void S9xXVDisplayDriver::create_window(int width, int height)
 
 void S9xXVDisplayDriver::update(uint16_t *buffer, int width, int height, int stride_in_pixels)
 {
+    output(buffer, 16, width, height, stride_in_pixels);
+}
+
+void S9xXVDisplayDriver::update32(uint32_t *buffer, int width, int height, int stride_in_pixels)
+{
+    output(buffer, 32, width, height, stride_in_pixels);
+}
+
+bool S9xXVDisplayDriver::uses_screen32()
+{
+    /* An XRGB8888 port in host byte order can take the core's 32-bit screen */
+#ifdef __BIG_ENDIAN__
+    bool native = config->force_inverted_byte_order;
+#else
+    bool native = !config->force_inverted_byte_order;
+#endif
+
+    return format != FOURCC_YUY2 && bpp == 32 && native &&
+           rshift == 8 && gshift == 16 && bshift == 24;
+}
+
+void S9xXVDisplayDriver::output(void *data, int src_bpp, int width, int height, int stride_in_pixels)
+{
+    uint16_t *buffer = (uint16_t *)data;
     int current_width, current_height;
 
     auto allocation = drawing_area->get_allocation();
@@ -95,7 +119,19 @@ void S9xXVDisplayDriver::update(uint16_t *buffer, int width, int height, int str
 
     update_image_size(width, height);
 
-    if (format == FOURCC_YUY2)
+    if (src_bpp == 32)
+    {
+        int copy_width = width + (width < xv_image->width ? (width % 2) + 4 : 0);
+        int copy_height = height + (height < xv_image->height ? 4 : 0);
+
+        for (int y = 0; y < copy_height; y++)
+        {
+            memcpy((uint8 *)xv_image->data + y * bytes_per_pixel * xv_image->width,
+                   (uint32_t *)data + y * stride_in_pixels,
+                   copy_width * 4);
+        }
+    }
+    else if (format == FOURCC_YUY2)
     {
         S9xConvertYUV(buffer,
                       (uint8 *)xv_image->data,
@@ -25,6 +25,8 @@ class S9xXVDisplayDriver : public S9xDisplayDriver
     int init();
     void deinit();
     void update(uint16_t *buffer, int width, int height, int stride_in_pixels);
+    void update32(uint32_t *buffer, int width, int height, int stride_in_pixels);
+    bool uses_screen32();
     void *get_parameters()
     {
         return NULL;
@@ -43,6 +45,7 @@ class S9xXVDisplayDriver : public S9xDisplayDriver
     void update_image_size(int width, int height);
     void resize_window(int width, int height);
     void create_window(int width, int height);
+    void output(void *data, int src_bpp, int width, int height, int stride_in_pixels);
 
     Display *display;
     Window xwindow;
@@ -52,6 +52,9 @@ static int g_screen_gun_height = SNES_HEIGHT;
 #define SNES_4_3 4.0f / 3.0f
 
 uint16 *screen_buffer = NULL;
+uint32 *screen32_buffer = NULL;
+static uint16 *last_screen_buffer = NULL;
+static bool can_dupe = false;
 
 char g_rom_dir[1024];
 char g_basename[1024];
@@ -300,6 +303,42 @@ void update_geometry(void)
     g_geometry_update = false;
 }
 
+static bool setup_pixel_format(void)
+{
+    struct retro_variable var;
+
+    var.key = "snes9x_32bit_color";
+    var.value = NULL;
+
+    GFX.Screen32 = NULL;
+
+    if (environ_cb && environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value && !strcmp(var.value, "enabled"))
+    {
+        /* The core keeps an XRGB8888 copy of GFX.Screen up to date as lines are drawn */
+        enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_XRGB8888;
+        if (environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+        {
+            if (!screen32_buffer)
+                screen32_buffer = (uint32*) calloc(1, GFX.Pitch * 2 * (MAX_SNES_HEIGHT + 16));
+            if (screen32_buffer)
+            {
+                GFX.Screen32 = screen32_buffer + (GFX.Pitch >> 1) * 16;
+                return true;
+            }
+        }
+    }
+
+    /* If we're in RGB565 format, switch frontend to that */
+    if (RED_SHIFT_BITS == 11)
+    {
+        enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
+        if (!environ_cb || !environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
+            return false;
+    }
+
+    return true;
+}
+
 static void update_variables(void)
 {
     char key[256];
@@ -1132,15 +1171,8 @@ bool retro_load_game(const struct retro_game_info *game)
 
     if (rom_loaded)
     {
-        /* If we're in RGB565 format, switch frontend to that */
-        if (RED_SHIFT_BITS == 11)
-        {
-            enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
-            if (!environ_cb || !environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
-            {
-                return false;
-            }
-        }
+        if (!setup_pixel_format())
+            return false;
 
         g_geometry_update = true;
 
@@ -1277,12 +1309,8 @@ bool retro_load_game_special(unsigned game_type, const struct retro_game_info *i
 
     if (rom_loaded)
     {
-        if(RED_SHIFT_BITS == 11)
-        {
-            enum retro_pixel_format fmt = RETRO_PIXEL_FORMAT_RGB565;
-            if (!environ_cb || !environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
-                return false;
-        }
+        if (!setup_pixel_format())
+            return false;
 
         g_geometry_update = true;
     }
@@ -1327,6 +1355,10 @@ void retro_init(void)
     bool achievements = true;
     environ_cb(RETRO_ENVIRONMENT_SET_SUPPORT_ACHIEVEMENTS, &achievements);
 
+    // Frames where no line changed can be passed on as dupes
+    if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &can_dupe))
+        can_dupe = false;
+
     memset(&Settings, 0, sizeof(Settings));
     Settings.MouseMaster = TRUE;
     Settings.SuperScopeMaster = TRUE;
@@ -1345,6 +1377,10 @@ void retro_init(void)
     Settings.InitialInfoStringTimeout = 120;
     Settings.HDMATimingHack = 100;
     Settings.BlockInvalidVRAMAccessMaster = TRUE;
+    Settings.SkipIdleLoopsMaster = TRUE;
+    Settings.BatchSA1Master = FALSE;
+    Settings.LazyAPUSync = FALSE;
+    Settings.ResamplerQuality = 0;
     Settings.SeparateEchoBuffer = FALSE;
     Settings.CartAName[0] = 0;
     Settings.CartBName[0] = 0;
@@ -1373,6 +1409,11 @@ void retro_init(void)
     GFX.Screen = screen_buffer + (GFX.Pitch >> 1) * 16;
     ntsc_screen_buffer = (uint16*) calloc(1, GFX.Pitch * (MAX_SNES_HEIGHT + 16));
     snes_ntsc_buffer = ntsc_screen_buffer + (GFX.Pitch >> 1) * 16;
+    if (can_dupe)
+    {
+        last_screen_buffer = (uint16*) calloc(1, GFX.Pitch * MAX_SNES_HEIGHT);
+        GFX.LastScreen = last_screen_buffer;
+    }
     S9xGraphicsInit();
 
     S9xInitInputDevices();
@@ -1860,7 +1901,13 @@ void retro_deinit()
     S9xUnmapAllControls();
 
     free(screen_buffer);
+    free(screen32_buffer);
+    screen32_buffer = NULL;
+    GFX.Screen32 = NULL;
     free(ntsc_screen_buffer);
+    free(last_screen_buffer);
+    last_screen_buffer = NULL;
+    GFX.LastScreen = NULL;
 }
 
 
@@ -1997,6 +2044,8 @@ bool8 S9xDeinitUpdate(int width, int height)
             {
                 overscan_offset = -16;
                 memset(GFX.Screen + (GFX.Pitch >> 1) * height,0,GFX.Pitch * ((SNES_HEIGHT_EXTENDED << 1) - height));
+                if (GFX.Screen32)
+                    memset(GFX.Screen32 + (GFX.Pitch >> 1) * height,0,GFX.Pitch * 2 * ((SNES_HEIGHT_EXTENDED << 1) - height));
             }
             height = SNES_HEIGHT_EXTENDED * 2;
         }
@@ -2006,13 +2055,70 @@ bool8 S9xDeinitUpdate(int width, int height)
             {
                 overscan_offset = -8;
                 memset(GFX.Screen + (GFX.Pitch >> 1) * height,0,GFX.Pitch * (SNES_HEIGHT_EXTENDED - height));
+                if (GFX.Screen32)
+                    memset(GFX.Screen32 + (GFX.Pitch >> 1) * height,0,GFX.Pitch * 2 * (SNES_HEIGHT_EXTENDED - height));
             }
             height = SNES_HEIGHT_EXTENDED;
         }
     }
 
+    // Nothing the frontend would get differs from the last frame: let it
+    // reuse that instead of converting and uploading the same image again.
+    static int last_width = 0, last_height = 0, last_offset = 0, last_blend = 0;
+    bool same_output = width == last_width && height == last_height && overscan_offset == last_offset && hires_blend == last_blend;
+
+    last_width = width;
+    last_height = height;
+    last_offset = overscan_offset;
+    last_blend = hires_blend;
+
+    if (can_dupe && same_output && !blargg_filter && S9xChangedLines() == 0)
+    {
+        video_cb(NULL, width, height, GFX.Pitch);
+        return TRUE;
+    }
+
+    if (GFX.Screen32)
+    {
+        if (width == MAX_SNES_WIDTH && hires_blend)
+        {
+            #define AVERAGE_8888(el0, el1) (((el0) & (el1)) + ((((el0) ^ (el1)) & 0xFEFEFE) >> 1))
+
+            for (int y = 0; y < height; y++)
+            {
+                uint32 *input = GFX.Screen32 + y * (GFX.Pitch >> 1);
+                uint32 *output = GFX.Screen32 + y * (GFX.Pitch >> 1);
+                uint32 l, r;
+
+                l = 0;
+                for (int x = 0; x < (width >> 1); x++)
+                {
+                    if (hires_blend == 1) /* Blur method */
+                    {
+                        r = *input++;
+                        *output++ = AVERAGE_8888 (l, r);
+                        l = r;
 
-    if (blargg_filter)
+                        r = *input++;
+                        *output++ = AVERAGE_8888 (l, r);
+                        l = r;
+                    }
+                    else /* Merge method */
+                    {
+                        l = *input++;
+                        r = *input++;
+                        *output++ = AVERAGE_8888 (l, r);
+                    }
+                }
+            }
+
+            if (hires_blend == 2)
+                width >>= 1;
+        }
+
+        video_cb(GFX.Screen32 + ((int)(GFX.Pitch >> 1) * overscan_offset), width, height, GFX.Pitch * 2);
+    }
+    else if (blargg_filter)
     {
         burst_phase = (burst_phase + 1) % 3;
 
@@ -130,6 +130,17 @@ struct retro_core_option_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "snes9x_32bit_color",
+      "32-bit Color Output (Restart)",
+      "Send frames to the frontend as XRGB8888, with each 5-bit SNES color channel expanded to the full 8-bit range, instead of RGB565. The Blargg NTSC filter is not available in this mode.",
+      {
+         { "disabled", NULL },
+         { "enabled",  NULL },
+         { NULL, NULL},
+      },
+      "disabled"
+   },
    {
       "snes9x_audio_interpolation",
       "Audio Interpolation",
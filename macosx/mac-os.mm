@@ -2570,6 +2570,9 @@ static void Initialize (void)
 	Settings.InitialInfoStringTimeout = 120;
 	Settings.HDMATimingHack = 100;
 	Settings.BlockInvalidVRAMAccessMaster = true;
+	Settings.SkipIdleLoopsMaster = true;
+	Settings.BatchSA1Master = false;
+	Settings.LazyAPUSync = false;
 	Settings.StopEmulation = true;
 	Settings.WrongMovieStateProtection = true;
 	Settings.DumpStreamsMaxFrames = -1;
@@ -2578,6 +2581,7 @@ static void Initialize (void)
 	Settings.OpenGLEnable = true;
 	Settings.SuperFXClockMultiplier = 100;
 	Settings.InterpolationMethod = DSP_INTERPOLATION_GAUSSIAN;
+	Settings.ResamplerQuality = 0;
 	Settings.MaxSpriteTilesPerLine = 34;
 	Settings.OneClockCycle = 6;
 	Settings.OneSlowClockCycle = 8;
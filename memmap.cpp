@@ -983,6 +983,11 @@ bool8 CMemory::Init (void)
 
 void CMemory::Deinit (void)
 {
+#ifdef PROFILER
+	if (ROMFilename[0])
+		S9xProfileDump(S9xGetFilename(".prof.json", LOG_DIR));
+#endif
+
 	if (RAM)
 	{
 		free(RAM);
@@ -2610,6 +2615,10 @@ void CMemory::InitROM (void)
 
 	IPPU.TotalEmulatedFrames = 0;
 
+#ifdef PROFILER
+	S9xProfileReset();
+#endif
+
 	//// Hack games
 
 	ApplyROMFixes();
@@ -2881,6 +2890,17 @@ void CMemory::map_SetaDSP (void)
 	// map_index(0x68, 0x6f, 0x0000, 0x0fff, MAP_SETA_DSP, ?);
 }
 
+// S-CPU accesses to I-RAM and BW-RAM go through the MAP_SA1RAM handlers, which catch up a batched SA-1.
+// SA1.Map keeps its direct pointers.
+void CMemory::map_SA1SharedRAM (void)
+{
+	for (int c = 0x000; c < 0x400; c += 0x10)
+		Map[c + 3] = Map[c + 0x803] = WriteMap[c + 3] = WriteMap[c + 0x803] = (uint8 *) MAP_SA1RAM;
+
+	for (int c = 0x400; c < 0x4f0; c++)
+		Map[c] = WriteMap[c] = (uint8 *) MAP_SA1RAM;
+}
+
 void CMemory::map_WriteProtectROM (void)
 {
 	memmove((void *) WriteMap, (void *) Map, sizeof(Map));
@@ -3330,6 +3350,407 @@ void CMemory::Map_BSCartHiROMMap(void)
 	map_WriteProtectROM();
 }
 
+// memory access
+
+#define LOROM_SRAM_ADDR(a, mask)	((((a) & 0xff0000) >> 1) | ((a) & 0x7fff)) & (mask)
+#define HIROM_SRAM_ADDR(a, mask)	(((a) & 0x7fff) - 0x6000 + (((a) & 0xf0000) >> 3)) & (mask)
+
+// I/O blocks read and write a byte at a time, taking the cycles of each access before the next one.
+#define MAP_IO_GET_HANDLERS(name, get) \
+static uint8 name##_GetByte (uint32 Address) \
+{ \
+	return (get(Address)); \
+} \
+\
+static uint16 name##_GetWord (uint32 Address, int32 speed) \
+{ \
+	uint16	word; \
+\
+	word  = get(Address); \
+	addCyclesInMemoryAccess; \
+	word |= get(Address + 1) << 8; \
+	addCyclesInMemoryAccess; \
+	return (word); \
+}
+
+#define MAP_IO_SET_HANDLERS(name, set) \
+static void name##_SetByte (uint8 Byte, uint32 Address) \
+{ \
+	set(Byte, Address); \
+} \
+\
+static void name##_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t o, int32 speed) \
+{ \
+	if (o) \
+	{ \
+		set(Word >> 8, Address + 1); \
+		addCyclesInMemoryAccess; \
+		set((uint8) Word, Address); \
+		addCyclesInMemoryAccess; \
+	} \
+	else \
+	{ \
+		set((uint8) Word, Address); \
+		addCyclesInMemoryAccess; \
+		set(Word >> 8, Address + 1); \
+		addCyclesInMemoryAccess; \
+	} \
+}
+
+#define MAP_IO_HANDLERS(name, get, set) \
+	MAP_IO_GET_HANDLERS(name, get) \
+	MAP_IO_SET_HANDLERS(name, set)
+
+#define GET_CPU(a)			S9xGetCPU((a) & 0xffff)
+#define SET_CPU(b, a)		S9xSetCPU(b, (a) & 0xffff)
+#define GET_DSP(a)			S9xGetDSP((a) & 0xffff)
+#define SET_DSP(b, a)		S9xSetDSP(b, (a) & 0xffff)
+#define GET_SPC7110_DRAM(a)	S9xGetSPC7110(0x4800)
+#define GET_C4(a)			S9xGetC4((a) & 0xffff)
+#define SET_C4(b, a)		S9xSetC4(b, (a) & 0xffff)
+#define GET_OBC1(a)			S9xGetOBC1((a) & 0xffff)
+#define SET_OBC1(b, a)		S9xSetOBC1(b, (a) & 0xffff)
+
+MAP_IO_HANDLERS(CPU,               GET_CPU,           SET_CPU)
+MAP_IO_HANDLERS(DSP,               GET_DSP,           SET_DSP)
+MAP_IO_GET_HANDLERS(SPC7110_ROM,   S9xGetSPC7110Byte)
+MAP_IO_GET_HANDLERS(SPC7110_DRAM,  GET_SPC7110_DRAM)
+MAP_IO_HANDLERS(C4,                GET_C4,            SET_C4)
+MAP_IO_HANDLERS(OBC_RAM,           GET_OBC1,          SET_OBC1)
+MAP_IO_HANDLERS(SETA_DSP,          S9xGetSetaDSP,     S9xSetSetaDSP)
+MAP_IO_HANDLERS(SETA_RISC,         S9xGetST018,       S9xSetST018)
+MAP_IO_HANDLERS(BSX,               S9xGetBSX,         S9xSetBSX)
+
+// $2100-$21ff can't be reached from the A bus during DMA.
+
+static uint8 PPU_GetByte (uint32 Address)
+{
+	if (CPU.InDMAorHDMA && (Address & 0xff00) == 0x2100)
+		return (OpenBus);
+
+	return (S9xGetPPU(Address & 0xffff));
+}
+
+static uint16 PPU_GetWord (uint32 Address, int32 speed)
+{
+	uint16	word;
+
+	if (CPU.InDMAorHDMA)
+	{
+		word = OpenBus = S9xGetByte(Address);
+		return (word | (S9xGetByte(Address + 1) << 8));
+	}
+
+	word  = S9xGetPPU(Address & 0xffff);
+	addCyclesInMemoryAccess;
+	word |= S9xGetPPU((Address + 1) & 0xffff) << 8;
+	addCyclesInMemoryAccess;
+	return (word);
+}
+
+static void PPU_SetByte (uint8 Byte, uint32 Address)
+{
+	if (CPU.InDMAorHDMA && (Address & 0xff00) == 0x2100)
+		return;
+
+	S9xSetPPU(Byte, Address & 0xffff);
+}
+
+static void PPU_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t o, int32 speed)
+{
+	if (CPU.InDMAorHDMA)
+	{
+		if ((Address & 0xff00) != 0x2100)
+			S9xSetPPU((uint8) Word, Address & 0xffff);
+		if (((Address + 1) & 0xff00) != 0x2100)
+			S9xSetPPU(Word >> 8, (Address + 1) & 0xffff);
+		return;
+	}
+
+	if (o)
+	{
+		S9xSetPPU(Word >> 8, (Address + 1) & 0xffff);
+		addCyclesInMemoryAccess;
+		S9xSetPPU((uint8) Word, Address & 0xffff);
+		addCyclesInMemoryAccess;
+	}
+	else
+	{
+		S9xSetPPU((uint8) Word, Address & 0xffff);
+		addCyclesInMemoryAccess;
+		S9xSetPPU(Word >> 8, (Address + 1) & 0xffff);
+		addCyclesInMemoryAccess;
+	}
+}
+
+// Cartridge RAM blocks are read and written as a whole word.
+
+static uint8 LOROM_SRAM_GetByte (uint32 Address)
+{
+	// Address & 0x7fff   : offset into bank
+	// Address & 0xff0000 : bank
+	// bank >> 1 | offset : SRAM address, unbound
+	// unbound & SRAMMask : SRAM offset
+	return (*(Memory.SRAM + (LOROM_SRAM_ADDR(Address, Memory.SRAMMask))));
+}
+
+static uint16 LOROM_SRAM_GetWord (uint32 Address, int32 speed)
+{
+	uint16	word;
+
+	if (Memory.SRAMMask >= MEMMAP_MASK)
+		word = READ_WORD(Memory.SRAM + (LOROM_SRAM_ADDR(Address, Memory.SRAMMask)));
+	else
+		word = (*(Memory.SRAM + (LOROM_SRAM_ADDR(Address, Memory.SRAMMask)))) |
+			  ((*(Memory.SRAM + (LOROM_SRAM_ADDR(Address + 1, Memory.SRAMMask)))) << 8);
+	addCyclesInMemoryAccess_x2;
+	return (word);
+}
+
+static void LOROM_SRAM_SetByte (uint8 Byte, uint32 Address)
+{
+	if (Memory.SRAMMask)
+	{
+		*(Memory.SRAM + (LOROM_SRAM_ADDR(Address, Memory.SRAMMask))) = Byte;
+		CPU.SRAMModified = TRUE;
+	}
+}
+
+static void LOROM_SRAM_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t, int32 speed)
+{
+	if (Memory.SRAMMask)
+	{
+		if (Memory.SRAMMask >= MEMMAP_MASK)
+			WRITE_WORD(Memory.SRAM + (LOROM_SRAM_ADDR(Address, Memory.SRAMMask)), Word);
+		else
+		{
+			*(Memory.SRAM + (LOROM_SRAM_ADDR(Address, Memory.SRAMMask))) = (uint8) Word;
+			*(Memory.SRAM + (LOROM_SRAM_ADDR(Address + 1, Memory.SRAMMask))) = Word >> 8;
+		}
+
+		CPU.SRAMModified = TRUE;
+	}
+
+	addCyclesInMemoryAccess_x2;
+}
+
+static uint8 LOROM_SRAM_B_GetByte (uint32 Address)
+{
+	return (*(Multi.sramB + (LOROM_SRAM_ADDR(Address, Multi.sramMaskB))));
+}
+
+static uint16 LOROM_SRAM_B_GetWord (uint32 Address, int32 speed)
+{
+	uint16	word;
+
+	if (Multi.sramMaskB >= MEMMAP_MASK)
+		word = READ_WORD(Multi.sramB + (LOROM_SRAM_ADDR(Address, Multi.sramMaskB)));
+	else
+		word = (*(Multi.sramB + (LOROM_SRAM_ADDR(Address, Multi.sramMaskB)))) |
+			  ((*(Multi.sramB + (LOROM_SRAM_ADDR(Address + 1, Multi.sramMaskB)))) << 8);
+	addCyclesInMemoryAccess_x2;
+	return (word);
+}
+
+static void LOROM_SRAM_B_SetByte (uint8 Byte, uint32 Address)
+{
+	if (Multi.sramMaskB)
+	{
+		*(Multi.sramB + (LOROM_SRAM_ADDR(Address, Multi.sramMaskB))) = Byte;
+		CPU.SRAMModified = TRUE;
+	}
+}
+
+static void LOROM_SRAM_B_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t, int32 speed)
+{
+	if (Multi.sramMaskB)
+	{
+		if (Multi.sramMaskB >= MEMMAP_MASK)
+			WRITE_WORD(Multi.sramB + (LOROM_SRAM_ADDR(Address, Multi.sramMaskB)), Word);
+		else
+		{
+			*(Multi.sramB + (LOROM_SRAM_ADDR(Address, Multi.sramMaskB))) = (uint8) Word;
+			*(Multi.sramB + (LOROM_SRAM_ADDR(Address + 1, Multi.sramMaskB))) = Word >> 8;
+		}
+
+		CPU.SRAMModified = TRUE;
+	}
+
+	addCyclesInMemoryAccess_x2;
+}
+
+static uint8 HIROM_SRAM_GetByte (uint32 Address)
+{
+	return (*(Memory.SRAM + (HIROM_SRAM_ADDR(Address, Memory.SRAMMask))));
+}
+
+static uint16 HIROM_SRAM_GetWord (uint32 Address, int32 speed)
+{
+	uint16	word;
+
+	if (Memory.SRAMMask >= MEMMAP_MASK)
+		word = READ_WORD(Memory.SRAM + (HIROM_SRAM_ADDR(Address, Memory.SRAMMask)));
+	else
+		word = (*(Memory.SRAM + (HIROM_SRAM_ADDR(Address, Memory.SRAMMask))) |
+			   (*(Memory.SRAM + (HIROM_SRAM_ADDR(Address + 1, Memory.SRAMMask))) << 8));
+	addCyclesInMemoryAccess_x2;
+	return (word);
+}
+
+static void HIROM_SRAM_SetByte (uint8 Byte, uint32 Address)
+{
+	if (Memory.SRAMMask)
+	{
+		*(Memory.SRAM + (HIROM_SRAM_ADDR(Address, Memory.SRAMMask))) = Byte;
+		CPU.SRAMModified = TRUE;
+	}
+}
+
+static void HIROM_SRAM_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t, int32 speed)
+{
+	if (Memory.SRAMMask)
+	{
+		if (Memory.SRAMMask >= MEMMAP_MASK)
+			WRITE_WORD(Memory.SRAM + (HIROM_SRAM_ADDR(Address, Memory.SRAMMask)), Word);
+		else
+		{
+			*(Memory.SRAM + (HIROM_SRAM_ADDR(Address, Memory.SRAMMask))) = (uint8) Word;
+			*(Memory.SRAM + (HIROM_SRAM_ADDR(Address + 1, Memory.SRAMMask))) = Word >> 8;
+		}
+
+		CPU.SRAMModified = TRUE;
+	}
+
+	addCyclesInMemoryAccess_x2;
+}
+
+// SA-1 I-RAM and BW-RAM as seen by the S-CPU. The SA-1 may be running behind, so it is caught up first.
+
+static uint8 SA1RAM_GetByte (uint32 Address)
+{
+	S9xSA1CatchUp();
+	return (*(S9xGetMemPointer(Address)));
+}
+
+static uint16 SA1RAM_GetWord (uint32 Address, int32 speed)
+{
+	S9xSA1CatchUp();
+	uint16	word = READ_WORD(S9xGetMemPointer(Address));
+	addCyclesInMemoryAccess_x2;
+	return (word);
+}
+
+static void SA1RAM_SetByte (uint8 Byte, uint32 Address)
+{
+	S9xSA1CatchUp();
+	*(S9xGetMemPointer(Address)) = Byte;
+}
+
+static void SA1RAM_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t, int32 speed)
+{
+	S9xSA1CatchUp();
+	WRITE_WORD(S9xGetMemPointer(Address), Word);
+	addCyclesInMemoryAccess_x2;
+}
+
+static uint8 BWRAM_GetByte (uint32 Address)
+{
+	S9xSA1CatchUp();
+	return (*(Memory.BWRAM + ((Address & 0x7fff) - 0x6000)));
+}
+
+static uint16 BWRAM_GetWord (uint32 Address, int32 speed)
+{
+	S9xSA1CatchUp();
+	uint16	word = READ_WORD(Memory.BWRAM + ((Address & 0x7fff) - 0x6000));
+	addCyclesInMemoryAccess_x2;
+	return (word);
+}
+
+static void BWRAM_SetByte (uint8 Byte, uint32 Address)
+{
+	S9xSA1CatchUp();
+	*(Memory.BWRAM + ((Address & 0x7fff) - 0x6000)) = Byte;
+	CPU.SRAMModified = TRUE;
+}
+
+static void BWRAM_SetWord (uint16 Word, uint32 Address, enum s9xwriteorder_t, int32 speed)
+{
+	S9xSA1CatchUp();
+	WRITE_WORD(Memory.BWRAM + ((Address & 0x7fff) - 0x6000), Word);
+	CPU.SRAMModified = TRUE;
+	addCyclesInMemoryAccess_x2;
+}
+
+static uint8 RONLY_SRAM_GetByte (uint32 Address)
+{
+	return (HIROM_SRAM_GetByte(Address));
+}
+
+static uint16 RONLY_SRAM_GetWord (uint32 Address, int32 speed)
+{
+	return (HIROM_SRAM_GetWord(Address, speed));
+}
+
+// Unmapped blocks, and anything only the SA-1 sees, read as open bus and ignore writes.
+
+static uint8 NONE_GetByte (uint32)
+{
+	return (OpenBus);
+}
+
+static uint16 NONE_GetWord (uint32, int32 speed)
+{
+	uint16	word = OpenBus | (OpenBus << 8);
+	addCyclesInMemoryAccess_x2;
+	return (word);
+}
+
+static void NONE_SetByte (uint8, uint32)
+{
+	return;
+}
+
+static void NONE_SetWord (uint16, uint32, enum s9xwriteorder_t, int32 speed)
+{
+	addCyclesInMemoryAccess_x2;
+}
+
+#define SPC7110_ROM_SetByte		NONE_SetByte
+#define SPC7110_ROM_SetWord		NONE_SetWord
+#define SPC7110_DRAM_SetByte	NONE_SetByte
+#define SPC7110_DRAM_SetWord	NONE_SetWord
+#define RONLY_SRAM_SetByte		NONE_SetByte
+#define RONLY_SRAM_SetWord		NONE_SetWord
+
+#define MAP_HANDLERS(suffix) \
+{ \
+	CPU_##suffix,				/* MAP_CPU */ \
+	PPU_##suffix,				/* MAP_PPU */ \
+	LOROM_SRAM_##suffix,		/* MAP_LOROM_SRAM */ \
+	LOROM_SRAM_B_##suffix,		/* MAP_LOROM_SRAM_B */ \
+	HIROM_SRAM_##suffix,		/* MAP_HIROM_SRAM */ \
+	DSP_##suffix,				/* MAP_DSP */ \
+	SA1RAM_##suffix,			/* MAP_SA1RAM */ \
+	BWRAM_##suffix,				/* MAP_BWRAM */ \
+	NONE_##suffix,				/* MAP_BWRAM_BITMAP */ \
+	NONE_##suffix,				/* MAP_BWRAM_BITMAP2 */ \
+	SPC7110_ROM_##suffix,		/* MAP_SPC7110_ROM */ \
+	SPC7110_DRAM_##suffix,		/* MAP_SPC7110_DRAM */ \
+	RONLY_SRAM_##suffix,		/* MAP_RONLY_SRAM */ \
+	C4_##suffix,				/* MAP_C4 */ \
+	OBC_RAM_##suffix,			/* MAP_OBC_RAM */ \
+	SETA_DSP_##suffix,			/* MAP_SETA_DSP */ \
+	SETA_RISC_##suffix,			/* MAP_SETA_RISC */ \
+	BSX_##suffix,				/* MAP_BSX */ \
+	NONE_##suffix				/* MAP_NONE */ \
+}
+
+S9xGetByteHandler	S9xGetByteHandlers[CMemory::MAP_LAST] = MAP_HANDLERS(GetByte);
+S9xGetWordHandler	S9xGetWordHandlers[CMemory::MAP_LAST] = MAP_HANDLERS(GetWord);
+S9xSetByteHandler	S9xSetByteHandlers[CMemory::MAP_LAST] = MAP_HANDLERS(SetByte);
+S9xSetWordHandler	S9xSetWordHandlers[CMemory::MAP_LAST] = MAP_HANDLERS(SetWord);
+
 // checksum
 
 uint16 CMemory::checksum_calc_sum (uint8 *data, uint32 length)
@@ -3598,6 +4019,11 @@ bool8 CMemory::match_id (const char *str)
 void CMemory::ApplyROMFixes (void)
 {
 	Settings.BlockInvalidVRAMAccess = Settings.BlockInvalidVRAMAccessMaster;
+	Settings.SkipIdleLoops = Settings.SkipIdleLoopsMaster && !Settings.SA1;
+	Settings.BatchSA1 = Settings.BatchSA1Master && Settings.SA1 && Multi.cartType != 5;
+
+	if (Settings.BatchSA1)
+		map_SA1SharedRAM();
 
 	if (Settings.DisableGameSpecificHacks)
 		return;
@@ -3618,6 +4044,7 @@ void CMemory::ApplyROMFixes (void)
 		// An infinite loop reads $4210 and checks NMI flag. This only works if LDA instruction executes before the NMI triggers,
 		// which doesn't work very well with s9x's default DMA timing.
 		Timings.DMACPUSync = 20;
+		Settings.SkipIdleLoops = FALSE;
 	}
 
 	if (Timings.DMACPUSync != 18)
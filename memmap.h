@@ -141,6 +141,7 @@ struct CMemory
 	void	map_OBC1 (void);
 	void	map_SetaRISC (void);
 	void	map_SetaDSP (void);
+	void	map_SA1SharedRAM (void);
 	void	map_WriteProtectROM (void);
 	void	Map_Initialize (void);
 	void	Map_LoROMMap (void);
@@ -21,6 +21,11 @@ size_t partial_frames;
 // Sample buffer
 static Resampler *msu_resampler = NULL;
 
+// Read-ahead buffer for the audio track, refilled a block at a time
+static uint8 audioBuffer[16384];
+static uint32 audioBufferStart;
+static uint32 audioBufferEnd;
+
 #ifdef UNZIP_SUPPORT
 static int unzFindExtension(unzFile &file, const char *ext, bool restart = TRUE, bool print = TRUE, bool allowExact = FALSE)
 {
@@ -97,8 +102,32 @@ STREAM S9xMSU1OpenFile(const char *msu_ext, bool skip_unpacked)
     return file;
 }
 
+static void AudioSeek(uint32 pos)
+{
+	REVERT_STREAM(audioStream, pos, 0);
+	audioBufferStart = audioBufferEnd = 0;
+}
+
+// Keeps what is left of the buffer and reads the next block behind it
+static int AudioFill()
+{
+	uint32 left = audioBufferEnd - audioBufferStart;
+
+	memmove(audioBuffer, audioBuffer + audioBufferStart, left);
+	audioBufferStart = 0;
+	audioBufferEnd = left;
+
+	int bytes_read = READ_STREAM((char *)audioBuffer + left, sizeof(audioBuffer) - left, audioStream);
+	if (bytes_read > 0)
+		audioBufferEnd += bytes_read;
+
+	return bytes_read;
+}
+
 static void AudioClose()
 {
+	audioBufferStart = audioBufferEnd = 0;
+
 	if (audioStream)
 	{
 		CLOSE_STREAM(audioStream);
@@ -234,38 +263,47 @@ void S9xMSU1Generate(size_t sample_count)
 	{
 		if (MSU1.MSU1_STATUS & AudioPlaying && audioStream)
 		{
-			int32 sample;
-			int16* left = (int16*)&sample;
-			int16* right = left + 1;
-
-			int bytes_read = READ_STREAM((char *)&sample, 4, audioStream);
-			if (bytes_read == 4)
+			if (audioBufferEnd - audioBufferStart < 4)
 			{
-				*left = ((int32)(int16)GET_LE16(left) * MSU1.MSU1_VOLUME / 255);
-				*right = ((int32)(int16)GET_LE16(right) * MSU1.MSU1_VOLUME / 255);
-
-				msu_resampler->push_sample(*left, *right);
-				MSU1.MSU1_AUDIO_POS += 4;
-				partial_frames -= 3204;
-			}
-			else
-			if (bytes_read >= 0)
-			{
-				if (MSU1.MSU1_STATUS & AudioRepeating)
+				if (AudioFill() < 0)
 				{
-					MSU1.MSU1_AUDIO_POS = audioLoopPos;
-					REVERT_STREAM(audioStream, MSU1.MSU1_AUDIO_POS, 0);
+					MSU1.MSU1_STATUS &= ~(AudioPlaying | AudioRepeating);
+					continue;
 				}
-				else
+
+				if (audioBufferEnd - audioBufferStart < 4)
 				{
-					MSU1.MSU1_STATUS &= ~(AudioPlaying | AudioRepeating);
-					REVERT_STREAM(audioStream, 8, 0);
+					if (MSU1.MSU1_STATUS & AudioRepeating)
+					{
+						MSU1.MSU1_AUDIO_POS = audioLoopPos;
+						AudioSeek(MSU1.MSU1_AUDIO_POS);
+					}
+					else
+					{
+						MSU1.MSU1_STATUS &= ~(AudioPlaying | AudioRepeating);
+						AudioSeek(8);
+					}
+					continue;
 				}
 			}
-			else
+
+			// Scale every frame that is both due and buffered in one go
+			uint32 frames = partial_frames / 3204;
+			if (frames > (audioBufferEnd - audioBufferStart) / 4)
+				frames = (audioBufferEnd - audioBufferStart) / 4;
+			const uint8 *p = audioBuffer + audioBufferStart;
+
+			for (uint32 i = 0; i < frames; i++, p += 4)
 			{
-				MSU1.MSU1_STATUS &= ~(AudioPlaying | AudioRepeating);
+				int16 left = (int32)(int16)GET_LE16(p) * MSU1.MSU1_VOLUME / 255;
+				int16 right = (int32)(int16)GET_LE16(p + 2) * MSU1.MSU1_VOLUME / 255;
+
+				msu_resampler->push_sample(left, right);
 			}
+
+			audioBufferStart += frames * 4;
+			MSU1.MSU1_AUDIO_POS += frames * 4;
+			partial_frames -= frames * 3204;
 		}
 		else
 		{
@@ -365,7 +403,7 @@ void S9xMSU1WritePort(uint8 port, uint8 byte)
 				MSU1.MSU1_AUDIO_POS = 8;
 			}
 
-            REVERT_STREAM(audioStream, MSU1.MSU1_AUDIO_POS, 0);
+            AudioSeek(MSU1.MSU1_AUDIO_POS);
 		}
 		break;
 	case 6:
@@ -416,7 +454,7 @@ void S9xMSU1PostLoadState(void)
 			audioLoopPos += 8;
 
 			MSU1.MSU1_AUDIO_POS = savedPosition;
-            REVERT_STREAM(audioStream, MSU1.MSU1_AUDIO_POS, 0);
+            AudioSeek(MSU1.MSU1_AUDIO_POS);
 		}
 		else
 		{
@@ -179,6 +179,8 @@ void S9xUpdateIRQPositions (bool initial)
 		}
 	}
 
+	S9xUpdateNextInterrupt();
+
 #ifdef DEBUGGER
 	S9xTraceFormattedMessage("--- IRQ Timer HC:%d VC:%d set %d cycles HTimer:%d Pos:%04d->%04d  VTimer:%d Pos:%03d->%03d", CPU.Cycles, CPU.V_Counter,
 		Timings.NextIRQTimer, PPU.HTimerEnabled, PPU.IRQHBeamPos, PPU.HTimerPosition, PPU.VTimerEnabled, PPU.IRQVBeamPos, PPU.VTimerPosition);
@@ -695,43 +697,19 @@ void S9xSetPPU (uint8 Byte, uint16 Address)
 				break;
 
 			case 0x2126: // WH0
-				if (Byte != Memory.FillRAM[0x2126])
-				{
-					FLUSH_REDRAW();
-					PPU.Window1Left = Byte;
-					PPU.RecomputeClipWindows = TRUE;
-				}
-
+				PPU.Window1Left = Byte;
 				break;
 
 			case 0x2127: // WH1
-				if (Byte != Memory.FillRAM[0x2127])
-				{
-					FLUSH_REDRAW();
-					PPU.Window1Right = Byte;
-					PPU.RecomputeClipWindows = TRUE;
-				}
-
+				PPU.Window1Right = Byte;
 				break;
 
 			case 0x2128: // WH2
-				if (Byte != Memory.FillRAM[0x2128])
-				{
-					FLUSH_REDRAW();
-					PPU.Window2Left = Byte;
-					PPU.RecomputeClipWindows = TRUE;
-				}
-
+				PPU.Window2Left = Byte;
 				break;
 
 			case 0x2129: // WH3
-				if (Byte != Memory.FillRAM[0x2129])
-				{
-					FLUSH_REDRAW();
-					PPU.Window2Right = Byte;
-					PPU.RecomputeClipWindows = TRUE;
-				}
-
+				PPU.Window2Right = Byte;
 				break;
 
 			case 0x212a: // WBGLOG
@@ -959,6 +937,8 @@ void S9xSetPPU (uint8 Byte, uint16 Address)
 		else
 		if (Settings.SA1     && Address >= 0x2200)
 		{
+			S9xSA1CatchUp();
+
 			if (Address <= 0x23ff)
 				S9xSetSA1(Byte, Address);
 			else
@@ -1210,7 +1190,10 @@ uint8 S9xGetPPU (uint16 Address)
 			return (S9xGetSuperFX(Address));
 		else
 		if (Settings.SA1     && Address >= 0x2200)
+		{
+			S9xSA1CatchUp();
 			return (S9xGetSA1(Address));
+		}
 		else
 		if (Settings.BS      && Address >= 0x2188 && Address <= 0x219f)
 			return (S9xGetBSXPPU(Address));
@@ -1747,6 +1730,44 @@ void S9xResetPPUFast (void)
 	memset(IPPU.TileCached[TILE_2BIT_ODD], 0, MAX_2BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_ODD], 0, MAX_4BIT_TILES);
+	memset(IPPU.VRAMDirty, 0, sizeof(IPPU.VRAMDirty));
+	IPPU.VRAMChanged = FALSE;
+}
+
+void S9xFlushTileCaches (void)
+{
+	// Each dirty bit is one 2-bit tile. The hires caches interleave a tile
+	// with the next one, so the tile before the written one goes too.
+	for (int i = 0; i < MAX_2BIT_TILES / 32; i++)
+	{
+		uint32	dirty = IPPU.VRAMDirty[i];
+		if (!dirty)
+			continue;
+
+		IPPU.VRAMDirty[i] = 0;
+
+		for (uint32 t2 = i * 32; dirty; dirty >>= 1, t2++)
+		{
+			if (!(dirty & 1))
+				continue;
+
+			uint32	t4 = t2 >> 1;
+
+			IPPU.TileCached[TILE_2BIT][t2] = FALSE;
+			IPPU.TileCached[TILE_4BIT][t4] = FALSE;
+			IPPU.TileCached[TILE_8BIT][t2 >> 2] = FALSE;
+			IPPU.TileCached[TILE_2BIT_EVEN][t2] = FALSE;
+			IPPU.TileCached[TILE_2BIT_EVEN][(t2 - 1) & (MAX_2BIT_TILES - 1)] = FALSE;
+			IPPU.TileCached[TILE_2BIT_ODD] [t2] = FALSE;
+			IPPU.TileCached[TILE_2BIT_ODD] [(t2 - 1) & (MAX_2BIT_TILES - 1)] = FALSE;
+			IPPU.TileCached[TILE_4BIT_EVEN][t4] = FALSE;
+			IPPU.TileCached[TILE_4BIT_EVEN][(t4 - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+			IPPU.TileCached[TILE_4BIT_ODD] [t4] = FALSE;
+			IPPU.TileCached[TILE_4BIT_ODD] [(t4 - 1) & (MAX_4BIT_TILES - 1)] = FALSE;
+		}
+	}
+
+	IPPU.VRAMChanged = FALSE;
 }
 
 void S9xSoftResetPPU (void)
@@ -1882,8 +1903,8 @@ void S9xSoftResetPPU (void)
 	PPU.OpenBus1 = 0;
 	PPU.OpenBus2 = 0;
 
-	for (int c = 0; c < 2; c++)
-		memset(&IPPU.Clip[c], 0, sizeof(struct ClipData));
+	memset(IPPU.Clip[0], 0, sizeof(IPPU.Clip[0]));
+	IPPU.ClipRuns = 0;
 	IPPU.ColorsChanged = TRUE;
 	IPPU.OBJChanged = TRUE;
 	memset(IPPU.TileCached[TILE_2BIT], 0, MAX_2BIT_TILES);
@@ -1893,6 +1914,8 @@ void S9xSoftResetPPU (void)
 	memset(IPPU.TileCached[TILE_2BIT_ODD], 0,  MAX_2BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_EVEN], 0, MAX_4BIT_TILES);
 	memset(IPPU.TileCached[TILE_4BIT_ODD], 0,  MAX_4BIT_TILES);
+	memset(IPPU.VRAMDirty, 0, sizeof(IPPU.VRAMDirty));
+	IPPU.VRAMChanged = FALSE;
 	PPU.VRAMReadBuffer = 0; // XXX: FIXME: anything better?
 	GFX.InterlaceFrame = 0;
 	GFX.DoInterlace = 0;
@@ -0,0 +1,112 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+#ifdef PROFILER
+
+#include "snes9x.h"
+#include "memmap.h"
+#include "profile.h"
+
+struct SProfile	S9xProfile;
+
+static const char	*cpu_names[PROFILE_NUM_CPUS] =
+{
+	"cpu",
+	"sa1",
+	"smp"
+};
+
+static const char	*map_names[CMemory::MAP_LAST + 1] =
+{
+	"cpu",
+	"ppu",
+	"lorom_sram",
+	"lorom_sram_b",
+	"hirom_sram",
+	"dsp",
+	"sa1ram",
+	"bwram",
+	"bwram_bitmap",
+	"bwram_bitmap2",
+	"spc7110_rom",
+	"spc7110_dram",
+	"ronly_sram",
+	"c4",
+	"obc_ram",
+	"seta_dsp",
+	"seta_risc",
+	"bsx",
+	"none",
+	"direct"
+};
+
+void S9xProfileReset (void)
+{
+	memset(&S9xProfile, 0, sizeof(S9xProfile));
+}
+
+static void S9xProfileDumpCPU (FILE *fp, int which)
+{
+	struct SProfileCPU	*p = &S9xProfile.CPU[which];
+	bool8				first = TRUE;
+
+	fprintf(fp, "\t\"%s\": {\n\t\t\"opcodes\": [", cpu_names[which]);
+
+	for (int op = 0; op < 256; op++)
+	{
+		if (!p->OpCount[op])
+			continue;
+
+		fprintf(fp, "%s\n\t\t\t{ \"op\": \"%02x\", \"count\": %llu, \"cycles\": %llu }", first ? "" : ",",
+			op, (unsigned long long) p->OpCount[op], (unsigned long long) p->OpCycles[op]);
+		first = FALSE;
+	}
+
+	fprintf(fp, "\n\t\t],\n\t\t\"pc\": [");
+	first = TRUE;
+
+	for (int i = 0; i < PROFILE_PC_BUCKETS; i++)
+	{
+		if (!p->PCCount[i])
+			continue;
+
+		fprintf(fp, "%s\n\t\t\t{ \"address\": \"%06x\", \"count\": %llu, \"cycles\": %llu }", first ? "" : ",",
+			i << PROFILE_PC_SHIFT, (unsigned long long) p->PCCount[i], (unsigned long long) p->PCCycles[i]);
+		first = FALSE;
+	}
+
+	fprintf(fp, "\n\t\t]\n\t}");
+}
+
+// Writes the counters gathered since S9xProfileReset() as JSON. Opcode and PC bucket cycles are in each
+// core's own units: master cycles for the CPU, SA-1 cycles and SPC700 clocks.
+bool8 S9xProfileDump (const char *filename)
+{
+	FILE	*fp = fopen(filename, "w");
+	if (!fp)
+		return (FALSE);
+
+	fprintf(fp, "{\n\t\"pc_bucket_size\": %d,\n", 1 << PROFILE_PC_SHIFT);
+
+	for (int which = 0; which < PROFILE_NUM_CPUS; which++)
+	{
+		S9xProfileDumpCPU(fp, which);
+		fprintf(fp, ",\n");
+	}
+
+	fprintf(fp, "\t\"memory\": [");
+
+	for (int i = 0; i <= CMemory::MAP_LAST; i++)
+		fprintf(fp, "%s\n\t\t{ \"region\": \"%s\", \"reads\": %llu, \"writes\": %llu }", i ? "," : "",
+			map_names[i], (unsigned long long) S9xProfile.MapReads[i], (unsigned long long) S9xProfile.MapWrites[i]);
+
+	fprintf(fp, "\n\t]\n}\n");
+	fclose(fp);
+
+	return (TRUE);
+}
+
+#endif
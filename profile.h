@@ -0,0 +1,72 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#ifdef PROFILER
+
+enum
+{
+	PROFILE_CPU,
+	PROFILE_SA1,
+	PROFILE_SMP,
+	PROFILE_NUM_CPUS
+};
+
+#define PROFILE_PC_SHIFT		8
+#define PROFILE_PC_BUCKETS		(0x1000000 >> PROFILE_PC_SHIFT)
+#define PROFILE_MAP_REGIONS		32		// one per CMemory::MAP_* value, plus direct pointers
+
+struct SProfileCPU
+{
+	uint64	OpCount[256];
+	uint64	OpCycles[256];
+	uint64	PCCount[PROFILE_PC_BUCKETS];
+	uint64	PCCycles[PROFILE_PC_BUCKETS];
+};
+
+struct SProfile
+{
+	struct SProfileCPU	CPU[PROFILE_NUM_CPUS];
+	uint64	MapReads[PROFILE_MAP_REGIONS];
+	uint64	MapWrites[PROFILE_MAP_REGIONS];
+	int64	CPUCycleBase;	// CPU.Cycles is rebased every scanline
+};
+
+extern struct SProfile	S9xProfile;
+
+void S9xProfileReset (void);
+bool8 S9xProfileDump (const char *);
+
+static inline void S9xProfileOp (int which, uint32 pc, uint8 op, int64 cycles)
+{
+	struct SProfileCPU	*p = &S9xProfile.CPU[which];
+
+	p->OpCount[op]++;
+	p->OpCycles[op] += cycles;
+	p->PCCount[pc >> PROFILE_PC_SHIFT]++;
+	p->PCCycles[pc >> PROFILE_PC_SHIFT] += cycles;
+}
+
+#define PROFILE_CPU_CYCLES()			(S9xProfile.CPUCycleBase + CPU.Cycles)
+#define PROFILE_CPU_REBASE(n)			S9xProfile.CPUCycleBase += (n)
+#define PROFILE_OP_START(pc, cycles)	uint32 ProfilePC = (pc); int64 ProfileCycles = (cycles)
+#define PROFILE_OP_END(which, op, cycles)	S9xProfileOp(which, ProfilePC, op, (cycles) - ProfileCycles)
+#define PROFILE_MAP_READ(p)				S9xProfile.MapReads[(p) >= (uint8 *) CMemory::MAP_LAST ? (pint) CMemory::MAP_LAST : (pint) (p)]++
+#define PROFILE_MAP_WRITE(p)			S9xProfile.MapWrites[(p) >= (uint8 *) CMemory::MAP_LAST ? (pint) CMemory::MAP_LAST : (pint) (p)]++
+
+#else
+
+#define PROFILE_CPU_REBASE(n)
+#define PROFILE_OP_START(pc, cycles)
+#define PROFILE_OP_END(which, op, cycles)
+#define PROFILE_MAP_READ(p)
+#define PROFILE_MAP_WRITE(p)
+
+#endif
+
+#endif
@@ -757,54 +757,145 @@ static void S9xSA1ReadVariableLengthData (bool8 inc, bool8 no_shift)
 	}
 }
 
-uint8 S9xSA1GetByte (uint32 address)
+// SA-1 accessors for blocks of SA1.Map / SA1.WriteMap that are not plain pointers, indexed by the CMemory::MAP_* value.
+
+static uint8 SA1_PPU_GetByte (uint32 address)
 {
-	uint8	*GetAddress = SA1.Map[(address & 0xffffff) >> MEMMAP_SHIFT];
+	SA1.Cycles += ONE_CYCLE;
+	return (S9xGetSA1(address & 0xffff));
+}
 
-	if (GetAddress >= (uint8 *)CMemory::MAP_LAST)
+static uint8 SA1_SRAM_GetByte (uint32 address)
+{
+	SA1.Cycles += ONE_CYCLE * 2;
+	return (*(Memory.SRAM + (address & 0x3ffff)));
+}
+
+static uint8 SA1_BWRAM_GetByte (uint32 address)
+{
+	SA1.Cycles += ONE_CYCLE * 2;
+	return (*(SA1.BWRAM + (address & 0x1fff)));
+}
+
+static uint8 SA1_BWRAM_BITMAP_GetByte (uint32 address)
+{
+	SA1.Cycles += ONE_CYCLE * 2;
+
+	address -= 0x600000;
+	if (SA1.VirtualBitmapFormat == 2)
+		return ((Memory.SRAM[(address >> 2) & 0x3ffff] >> ((address & 3) << 1)) &  3);
+	else
+		return ((Memory.SRAM[(address >> 1) & 0x3ffff] >> ((address & 1) << 2)) & 15);
+}
+
+static uint8 SA1_BWRAM_BITMAP2_GetByte (uint32 address)
+{
+	SA1.Cycles += ONE_CYCLE * 2;
+
+	address = (address & 0xffff) - 0x6000;
+	if (SA1.VirtualBitmapFormat == 2)
+		return ((SA1.BWRAM[(address >> 2) & 0x3ffff] >> ((address & 3) << 1)) &  3);
+	else
+		return ((SA1.BWRAM[(address >> 1) & 0x3ffff] >> ((address & 1) << 2)) & 15);
+}
+
+static uint8 SA1_NONE_GetByte (uint32)
+{
+	SA1.Cycles += ONE_CYCLE;
+	return (SA1OpenBus);
+}
+
+static void SA1_PPU_SetByte (uint8 byte, uint32 address)
+{
+	S9xSetSA1(byte, address & 0xffff);
+}
+
+static void SA1_SRAM_SetByte (uint8 byte, uint32 address)
+{
+	*(Memory.SRAM + (address & 0x3ffff)) = byte;
+}
+
+static void SA1_BWRAM_SetByte (uint8 byte, uint32 address)
+{
+	*(SA1.BWRAM + (address & 0x1fff)) = byte;
+}
+
+static void SA1_BWRAM_BITMAP_SetByte (uint8 byte, uint32 address)
+{
+	address -= 0x600000;
+	if (SA1.VirtualBitmapFormat == 2)
 	{
-		SA1.Cycles += SA1.MemSpeed;
-		return (*(GetAddress + (address & 0xffff)));
+		uint8	*ptr = &Memory.SRAM[(address >> 2) & 0x3ffff];
+		*ptr &= ~(3  << ((address & 3) << 1));
+		*ptr |= (byte &  3) << ((address & 3) << 1);
 	}
-
-	switch ((pint) GetAddress)
+	else
 	{
-		case CMemory::MAP_PPU:
-			SA1.Cycles += ONE_CYCLE;
-			return (S9xGetSA1(address & 0xffff));
-
-		case CMemory::MAP_LOROM_SRAM:
-		case CMemory::MAP_HIROM_SRAM:
-		case CMemory::MAP_SA1RAM:
-			SA1.Cycles += ONE_CYCLE * 2;
-			return (*(Memory.SRAM + (address & 0x3ffff)));
+		uint8	*ptr = &Memory.SRAM[(address >> 1) & 0x3ffff];
+		*ptr &= ~(15 << ((address & 1) << 2));
+		*ptr |= (byte & 15) << ((address & 1) << 2);
+	}
+}
 
-		case CMemory::MAP_BWRAM:
-			SA1.Cycles += ONE_CYCLE * 2;
-			return (*(SA1.BWRAM + (address & 0x1fff)));
+static void SA1_BWRAM_BITMAP2_SetByte (uint8 byte, uint32 address)
+{
+	address = (address & 0xffff) - 0x6000;
+	if (SA1.VirtualBitmapFormat == 2)
+	{
+		uint8	*ptr = &SA1.BWRAM[(address >> 2) & 0x3ffff];
+		*ptr &= ~(3  << ((address & 3) << 1));
+		*ptr |= (byte &  3) << ((address & 3) << 1);
+	}
+	else
+	{
+		uint8	*ptr = &SA1.BWRAM[(address >> 1) & 0x3ffff];
+		*ptr &= ~(15 << ((address & 1) << 2));
+		*ptr |= (byte & 15) << ((address & 1) << 2);
+	}
+}
 
-		case CMemory::MAP_BWRAM_BITMAP:
-			SA1.Cycles += ONE_CYCLE * 2;
+static void SA1_NONE_SetByte (uint8, uint32)
+{
+	return;
+}
 
-			address -= 0x600000;
-			if (SA1.VirtualBitmapFormat == 2)
-				return ((Memory.SRAM[(address >> 2) & 0x3ffff] >> ((address & 3) << 1)) &  3);
-			else
-				return ((Memory.SRAM[(address >> 1) & 0x3ffff] >> ((address & 1) << 2)) & 15);
+#define SA1_MAP_HANDLERS(suffix) \
+{ \
+	SA1_NONE_##suffix,				/* MAP_CPU */ \
+	SA1_PPU_##suffix,				/* MAP_PPU */ \
+	SA1_SRAM_##suffix,				/* MAP_LOROM_SRAM */ \
+	SA1_NONE_##suffix,				/* MAP_LOROM_SRAM_B */ \
+	SA1_SRAM_##suffix,				/* MAP_HIROM_SRAM */ \
+	SA1_NONE_##suffix,				/* MAP_DSP */ \
+	SA1_SRAM_##suffix,				/* MAP_SA1RAM */ \
+	SA1_BWRAM_##suffix,				/* MAP_BWRAM */ \
+	SA1_BWRAM_BITMAP_##suffix,		/* MAP_BWRAM_BITMAP */ \
+	SA1_BWRAM_BITMAP2_##suffix,		/* MAP_BWRAM_BITMAP2 */ \
+	SA1_NONE_##suffix,				/* MAP_SPC7110_ROM */ \
+	SA1_NONE_##suffix,				/* MAP_SPC7110_DRAM */ \
+	SA1_NONE_##suffix,				/* MAP_RONLY_SRAM */ \
+	SA1_NONE_##suffix,				/* MAP_C4 */ \
+	SA1_NONE_##suffix,				/* MAP_OBC_RAM */ \
+	SA1_NONE_##suffix,				/* MAP_SETA_DSP */ \
+	SA1_NONE_##suffix,				/* MAP_SETA_RISC */ \
+	SA1_NONE_##suffix,				/* MAP_BSX */ \
+	SA1_NONE_##suffix				/* MAP_NONE */ \
+}
 
-		case CMemory::MAP_BWRAM_BITMAP2:
-			SA1.Cycles += ONE_CYCLE * 2;
+static uint8	(*SA1GetByteHandlers[CMemory::MAP_LAST]) (uint32) = SA1_MAP_HANDLERS(GetByte);
+static void		(*SA1SetByteHandlers[CMemory::MAP_LAST]) (uint8, uint32) = SA1_MAP_HANDLERS(SetByte);
 
-			address = (address & 0xffff) - 0x6000;
-			if (SA1.VirtualBitmapFormat == 2)
-				return ((SA1.BWRAM[(address >> 2) & 0x3ffff] >> ((address & 3) << 1)) &  3);
-			else
-				return ((SA1.BWRAM[(address >> 1) & 0x3ffff] >> ((address & 1) << 2)) & 15);
+uint8 S9xSA1GetByte (uint32 address)
+{
+	uint8	*GetAddress = SA1.Map[(address & 0xffffff) >> MEMMAP_SHIFT];
 
-		default:
-			SA1.Cycles += ONE_CYCLE;
-			return (SA1OpenBus);
+	if (GetAddress >= (uint8 *)CMemory::MAP_LAST)
+	{
+		SA1.Cycles += SA1.MemSpeed;
+		return (*(GetAddress + (address & 0xffff)));
 	}
+
+	return (SA1GetByteHandlers[(pint) GetAddress](address));
 }
 
 uint16 S9xSA1GetWord (uint32 address, s9xwrap_t w)
@@ -841,59 +932,7 @@ void S9xSA1SetByte (uint8 byte, uint32 address)
 		return;
 	}
 
-	switch ((pint) SetAddress)
-	{
-		case CMemory::MAP_PPU:
-			S9xSetSA1(byte, address & 0xffff);
-			return;
-
-		case CMemory::MAP_LOROM_SRAM:
-		case CMemory::MAP_HIROM_SRAM:
-		case CMemory::MAP_SA1RAM:
-			*(Memory.SRAM + (address & 0x3ffff)) = byte;
-			return;
-
-		case CMemory::MAP_BWRAM:
-			*(SA1.BWRAM + (address & 0x1fff)) = byte;
-			return;
-
-		case CMemory::MAP_BWRAM_BITMAP:
-			address -= 0x600000;
-			if (SA1.VirtualBitmapFormat == 2)
-			{
-				uint8	*ptr = &Memory.SRAM[(address >> 2) & 0x3ffff];
-				*ptr &= ~(3  << ((address & 3) << 1));
-				*ptr |= (byte &  3) << ((address & 3) << 1);
-			}
-			else
-			{
-				uint8	*ptr = &Memory.SRAM[(address >> 1) & 0x3ffff];
-				*ptr &= ~(15 << ((address & 1) << 2));
-				*ptr |= (byte & 15) << ((address & 1) << 2);
-			}
-
-			return;
-
-		case CMemory::MAP_BWRAM_BITMAP2:
-			address = (address & 0xffff) - 0x6000;
-			if (SA1.VirtualBitmapFormat == 2)
-			{
-				uint8	*ptr = &SA1.BWRAM[(address >> 2) & 0x3ffff];
-				*ptr &= ~(3  << ((address & 3) << 1));
-				*ptr |= (byte &  3) << ((address & 3) << 1);
-			}
-			else
-			{
-				uint8	*ptr = &SA1.BWRAM[(address >> 1) & 0x3ffff];
-				*ptr &= ~(15 << ((address & 1) << 2));
-				*ptr |= (byte & 15) << ((address & 1) << 2);
-			}
-
-			return;
-
-		default:
-			return;
-	}
+	SA1SetByteHandlers[(pint) SetAddress](byte, address);
 }
 
 void S9xSA1SetWord (uint16 Word, uint32 address, enum s9xwrap_t w, enum s9xwriteorder_t o)
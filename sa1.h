@@ -93,8 +93,31 @@ uint8 S9xGetSA1 (uint32);
 void S9xSetSA1 (uint8, uint32);
 void S9xSA1Init (void);
 void S9xSA1MainLoop (void);
+void S9xSA1ExecuteBatch (void);
 void S9xSA1PostLoadState (void);
 
+// With Settings.BatchSA1 the SA-1 is allowed to fall behind the S-CPU by up to this many SA-1 cycles (16 S-CPU
+// memory cycles). It is caught up before any S-CPU access to its registers, I-RAM or BW-RAM, before DMA and
+// events, and whenever the lag reaches this bound, which also bounds the delay of its IRQs to the S-CPU.
+#define SA1_BATCH_CYCLES	(ONE_CYCLE * 3 * 16)
+
+static inline void S9xSA1CatchUp (void)
+{
+	if (Settings.BatchSA1 && SA1.Cycles < CPU.Cycles * 3)
+		S9xSA1ExecuteBatch();
+}
+
+// Called by S9xMainLoop after each S-CPU opcode. While the SA-1 is held in reset or waiting it is still
+// stepped here, so its clock and timer advance per S-CPU opcode exactly as without batching.
+static inline void S9xSA1Step (void)
+{
+	if (!Settings.BatchSA1 || (Memory.FillRAM[0x2200] & 0x60))
+		S9xSA1MainLoop();
+	else
+	if (CPU.Cycles * 3 - SA1.Cycles >= SA1_BATCH_CYCLES)
+		S9xSA1ExecuteBatch();
+}
+
 static inline void S9xSA1UnpackStatus (void)
 {
 	SA1._Zero = (SA1Registers.PL & Zero) == 0;
@@ -55,6 +55,7 @@
 #include "cpuops.cpp"
 
 static void S9xSA1UpdateTimer (void);
+static void S9xSA1Execute (int32);
 
 
 void S9xSA1MainLoop (void)
@@ -66,6 +67,35 @@ void S9xSA1MainLoop (void)
 		return;
 	}
 
+	#undef CPU
+	int cycles = CPU.Cycles * 3;
+	#define CPU SA1
+
+	S9xSA1Execute(cycles);
+}
+
+// Runs the SA-1 up to the S-CPU's clock in slices of SA1_BATCH_CYCLES, so that its interrupts are still checked
+// and its timer still advanced about as often as when it is stepped after every S-CPU opcode.
+void S9xSA1ExecuteBatch (void)
+{
+	#undef CPU
+	int32	cycles = CPU.Cycles * 3;
+	#define CPU SA1
+
+	// Only the S-CPU changes $2200, and it catches the SA-1 up first. While the SA-1 is held
+	// S9xSA1Step keeps stepping it per opcode, so there is nothing to catch up here.
+	while (SA1.Cycles < cycles && !(Memory.FillRAM[0x2200] & 0x60))
+	{
+		int32	slice = SA1.Cycles + SA1_BATCH_CYCLES;
+		if (slice > cycles)
+			slice = cycles;
+
+		S9xSA1Execute(slice);
+	}
+}
+
+static void S9xSA1Execute (int32 cycles)
+{
 	// SA-1 NMI
 	if ((Memory.FillRAM[0x2200] & 0x10) && !(Memory.FillRAM[0x220b] & 0x10))
 	{
@@ -126,10 +156,6 @@ void S9xSA1MainLoop (void)
 		}
 	}
 
-	#undef CPU
-	int cycles = CPU.Cycles * 3;
-	#define CPU SA1
-
 	for (; SA1.Cycles < cycles && !(Memory.FillRAM[0x2200] & 0x60);)
 	{
 	#ifdef DEBUGGER
@@ -137,6 +163,8 @@ void S9xSA1MainLoop (void)
 			S9xSA1Trace();
 	#endif
 
+		PROFILE_OP_START(Registers.PBPC, SA1.Cycles);
+
 		uint8				Op;
 		struct SOpcodes	*Opcodes;
 
@@ -162,6 +190,8 @@ void S9xSA1MainLoop (void)
 
 		Registers.PCw++;
 		(*Opcodes[Op].S9xOpcode)();
+
+		PROFILE_OP_END(PROFILE_SA1, Op, SA1.Cycles);
 	}
 
 	S9xSA1UpdateTimer();
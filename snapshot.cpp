@@ -1678,9 +1678,11 @@ int S9xUnfreezeFromStream (STREAM stream)
 		ICPU.ShiftedPB = Registers.PB << 16;
 		ICPU.ShiftedDB = Registers.DB << 16;
 		S9xSetPCBase(Registers.PBPC);
+		S9xResetIdleLoop();
 		S9xUnpackStatus();
 		if(version < SNAPSHOT_VERSION_IRQ_2018)
 			S9xUpdateIRQPositions(false); // calculate the new trigger pos from saved PPU data
+		S9xUpdateNextInterrupt();
 		S9xFixCycles();
 
 		for (int d = 0; d < 8; d++)
@@ -1702,7 +1704,11 @@ int S9xUnfreezeFromStream (STREAM stream)
 		S9xGraphicsScreenResize();
 		
 		if (Settings.FastSavestates == 0)
+		{
 			memset(GFX.Screen,0,GFX.Pitch * MAX_SNES_HEIGHT);
+			if (GFX.Screen32)
+				S9xUpdateScreen32(0, MAX_SNES_HEIGHT);
+		}
 
 		// TODO: this seems to be a relic from 1.43 changes, completely remove if no issues in the future
 		/*uint8 hdma_byte = Memory.FillRAM[0x420c];
@@ -1798,6 +1804,9 @@ int S9xUnfreezeFromStream (STREAM stream)
 			for (uint32 y = IPPU.RenderedScreenHeight; y < (uint32) (IMAGE_HEIGHT); y++)
 				memset(GFX.Screen + y * GFX.RealPPL, 0, GFX.RealPPL * 2);
 
+			if (GFX.Screen32)
+				S9xUpdateScreen32(0, IMAGE_HEIGHT);
+
 			delete ssi;
 		}
 	}
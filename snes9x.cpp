@@ -235,6 +235,7 @@ void S9xLoadConfigFiles (char **argv, int argc)
 	// Sound
 
 	Settings.SoundSync                  =  conf.GetBool("Sound::Sync",                         false);
+	Settings.LazyAPUSync                =  conf.GetBool("Sound::LazySync",                     false);
 	Settings.SixteenBitSound            =  conf.GetBool("Sound::16BitSound",                   true);
 	Settings.Stereo                     =  conf.GetBool("Sound::Stereo",                       true);
 	Settings.ReverseStereo              =  conf.GetBool("Sound::ReverseStereo",                false);
@@ -244,6 +245,7 @@ void S9xLoadConfigFiles (char **argv, int argc)
 	Settings.DynamicRateControl         =  conf.GetBool("Sound::DynamicRateControl",           false);
 	Settings.DynamicRateLimit           =  conf.GetInt ("Sound::DynamicRateLimit",             5);
 	Settings.InterpolationMethod        =  conf.GetInt ("Sound::InterpolationMethod",          2);
+	Settings.ResamplerQuality           =  conf.GetInt ("Sound::ResamplerQuality",             0);
 
 	// Display
 
@@ -313,6 +315,9 @@ void S9xLoadConfigFiles (char **argv, int argc)
     Settings.SeparateEchoBuffer             = conf.GetBool("Hack::SeparateEchoBuffer", false);
 	Settings.DisableGameSpecificHacks       = !conf.GetBool("Hack::EnableGameSpecificHacks",       true);
 	Settings.BlockInvalidVRAMAccessMaster   = !conf.GetBool("Hack::AllowInvalidVRAMAccess",        false);
+	Settings.SkipIdleLoopsMaster            =  conf.GetBool("Hack::SkipIdleLoops",                 true);
+	Settings.DisableCPUBlockCache           = !conf.GetBool("Hack::CPUBlockCache",                 true);
+	Settings.BatchSA1Master                 =  conf.GetBool("Hack::BatchSA1",                      false);
 	Settings.HDMATimingHack                 =  conf.GetInt ("Hack::HDMATiming",                    100);
 	Settings.MaxSpriteTilesPerLine          =  conf.GetInt ("Hack::MaxSpriteTilesPerLine",         34);
 
@@ -360,8 +365,10 @@ void S9xUsage (void)
 
 	// SOUND OPTIONS
 	S9xMessage(S9X_INFO, S9X_USAGE, "-soundsync                      Synchronize sound as far as possible");
+	S9xMessage(S9X_INFO, S9X_USAGE, "-lazysync                       Run the sound CPU on demand instead of every scanline");
 	S9xMessage(S9X_INFO, S9X_USAGE, "-playbackrate <Hz>              Set sound playback rate");
 	S9xMessage(S9X_INFO, S9X_USAGE, "-inputrate <Hz>                 Set sound input rate");
+	S9xMessage(S9X_INFO, S9X_USAGE, "-resamplerquality <0-3>         0 = Hermite, 1-3 = windowed sinc, higher is better");
 	S9xMessage(S9X_INFO, S9X_USAGE, "-reversestereo                  Reverse stereo sound output");
 	S9xMessage(S9X_INFO, S9X_USAGE, "-nostereo                       Disable stereo sound output");
 	S9xMessage(S9X_INFO, S9X_USAGE, "-eightbit                       Use 8bit sound instead of 16bit");
@@ -436,6 +443,9 @@ void S9xUsage (void)
 	S9xMessage(S9X_INFO, S9X_USAGE, "-hdmatiming <1-199>             (Not recommended) Changes HDMA transfer timings");
 	S9xMessage(S9X_INFO, S9X_USAGE, "                                event comes");
 	S9xMessage(S9X_INFO, S9X_USAGE, "-invalidvramaccess              (Not recommended) Allow invalid VRAM access");
+	S9xMessage(S9X_INFO, S9X_USAGE, "-noidleloopskip                 Run CPU idle loops instead of skipping to the next event");
+	S9xMessage(S9X_INFO, S9X_USAGE, "-noblockcache                   Interpret every opcode instead of caching ROM code runs");
+	S9xMessage(S9X_INFO, S9X_USAGE, "-batchsa1                       (Changes SA-1 timing) Run the SA-1 in batches behind the CPU");
 	S9xMessage(S9X_INFO, S9X_USAGE, "");
 
 	// OTHER OPTIONS
@@ -494,6 +504,9 @@ char * S9xParseArgs (char **argv, int argc)
 
 			if (!strcasecmp(argv[i], "-soundsync"))
 				Settings.SoundSync = TRUE;
+			else
+			if (!strcasecmp(argv[i], "-lazysync"))
+				Settings.LazyAPUSync = TRUE;
 			else if (!strcasecmp(argv[i], "-dynamicratecontrol"))
 			{
 				Settings.DynamicRateControl = TRUE;
@@ -526,6 +539,14 @@ char * S9xParseArgs (char **argv, int argc)
 					S9xUsage();
 			}
 			else
+			if (!strcasecmp(argv[i], "-resamplerquality"))
+			{
+				if (i + 1 < argc)
+					Settings.ResamplerQuality = atoi(argv[++i]);
+				else
+					S9xUsage();
+			}
+			else
 			if (!strcasecmp(argv[i], "-reversestereo"))
 				Settings.ReverseStereo = TRUE;
 			else
@@ -721,6 +742,15 @@ char * S9xParseArgs (char **argv, int argc)
 			if (!strcasecmp(argv[i], "-invalidvramaccess"))
 				Settings.BlockInvalidVRAMAccessMaster = FALSE;
 			else
+			if (!strcasecmp(argv[i], "-noidleloopskip"))
+				Settings.SkipIdleLoopsMaster = FALSE;
+			else
+			if (!strcasecmp(argv[i], "-noblockcache"))
+				Settings.DisableCPUBlockCache = TRUE;
+			else
+			if (!strcasecmp(argv[i], "-batchsa1"))
+				Settings.BatchSA1Master = TRUE;
+			else
 
 			// OTHER OPTIONS
 
@@ -175,6 +175,7 @@ struct STimings
 	int32	HDMAStart;
 	int32	NMITriggerPos;
 	int32	NextIRQTimer;
+	int32	NextInterrupt;	// The earlier of NMITriggerPos (while an NMI is pending) and NextIRQTimer.
 	int32	IRQTriggerCycles;
 	int32	WRAMRefreshPos;
 	int32	RenderPos;
@@ -232,6 +233,7 @@ struct SSettings
 	uint32	FrameTime;
 
 	bool8	SoundSync;
+	bool8	LazyAPUSync;
 	bool8	SixteenBitSound;
 	uint32	SoundPlaybackRate;
 	uint32	SoundInputRate;
@@ -241,6 +243,7 @@ struct SSettings
 	bool8	DynamicRateControl;
 	int32	DynamicRateLimit; /* Multiplied by 1000 */
 	int32	InterpolationMethod;
+	int32	ResamplerQuality;
 
 	bool8	SupportHiRes;
 	bool8	Transparency;
@@ -264,6 +267,11 @@ struct SSettings
 	bool8	DisableGameSpecificHacks;
 	bool8	BlockInvalidVRAMAccessMaster;
 	bool8	BlockInvalidVRAMAccess;
+	bool8	SkipIdleLoopsMaster;
+	bool8	SkipIdleLoops;
+	bool8	BatchSA1Master;
+	bool8	BatchSA1;
+	bool8	DisableCPUBlockCache;
 	int32	HDMATimingHack;
 
 	bool8	ForcedPause;
@@ -6,42 +6,39 @@
 
 #include "tileimpl.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 using namespace TileImpl;
 
 namespace {
 
-	uint32	pixbit[8][16];
+	uint64	pixbit[256];
 	uint8	hrbit_odd[256];
 	uint8	hrbit_even[256];
 
 	// Here are the tile converters, selected by S9xSelectTileConverter().
+	// pixbit[] spreads the bits of one bitplane byte into the low bit of the 8 pixel bytes of a cached line, so
+	// a line is the OR of the pixbit[] entries of its bitplanes, each shifted to the plane's bit.
 	// Really, except for the definition of DOBIT and the number of times it is called, they're all the same.
 
 	#define DOBIT(n, i) \
-		if ((pix = *(tp + (n)))) \
-		{ \
-			p1 |= pixbit[(i)][pix >> 4]; \
-			p2 |= pixbit[(i)][pix & 0xf]; \
-		}
+		(pixbit[*(tp + (n))] << (i))
 
 	uint8 ConvertTile2 (uint8 *pCache, uint32 TileAddr, uint32)
 	{
 		uint8	*tp      = &Memory.VRAM[TileAddr];
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		for (line = 8; line != 0; line--, tp += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -50,23 +47,18 @@ namespace {
 	uint8 ConvertTile4 (uint8 *pCache, uint32 TileAddr, uint32)
 	{
 		uint8	*tp      = &Memory.VRAM[TileAddr];
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		for (line = 8; line != 0; line--, tp += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			DOBIT(16, 2);
-			DOBIT(17, 3);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1) |
+						  DOBIT(16, 2) |
+						  DOBIT(17, 3);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -75,27 +67,22 @@ namespace {
 	uint8 ConvertTile8 (uint8 *pCache, uint32 TileAddr, uint32)
 	{
 		uint8	*tp      = &Memory.VRAM[TileAddr];
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		for (line = 8; line != 0; line--, tp += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			DOBIT(16, 2);
-			DOBIT(17, 3);
-			DOBIT(32, 4);
-			DOBIT(33, 5);
-			DOBIT(48, 6);
-			DOBIT(49, 7);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1) |
+						  DOBIT(16, 2) |
+						  DOBIT(17, 3) |
+						  DOBIT(32, 4) |
+						  DOBIT(33, 5) |
+						  DOBIT(48, 6) |
+						  DOBIT(49, 7);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -103,18 +90,17 @@ namespace {
 
 	#undef DOBIT
 
+	// The hires converters take every other pixel of a tile and of the one after it, giving the left and right
+	// halves of a bitplane byte.
 	#define DOBIT(n, i) \
-		if ((pix = hrbit_odd[*(tp1 + (n))])) \
-			p1 |= pixbit[(i)][pix]; \
-		if ((pix = hrbit_odd[*(tp2 + (n))])) \
-			p2 |= pixbit[(i)][pix];
+		(pixbit[(hrbit_odd[*(tp1 + (n))] << 4) | hrbit_odd[*(tp2 + (n))]] << (i))
 
 	uint8 ConvertTile2h_odd (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 	{
 		uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		if (Tile == 0x3ff)
 			tp2 = tp1 - (0x3ff << 4);
@@ -123,15 +109,10 @@ namespace {
 
 		for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -140,9 +121,9 @@ namespace {
 	uint8 ConvertTile4h_odd (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 	{
 		uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		if (Tile == 0x3ff)
 			tp2 = tp1 - (0x3ff << 5);
@@ -151,17 +132,12 @@ namespace {
 
 		for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			DOBIT(16, 2);
-			DOBIT(17, 3);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1) |
+						  DOBIT(16, 2) |
+						  DOBIT(17, 3);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -170,17 +146,14 @@ namespace {
 	#undef DOBIT
 
 	#define DOBIT(n, i) \
-		if ((pix = hrbit_even[*(tp1 + (n))])) \
-			p1 |= pixbit[(i)][pix]; \
-		if ((pix = hrbit_even[*(tp2 + (n))])) \
-			p2 |= pixbit[(i)][pix];
+		(pixbit[(hrbit_even[*(tp1 + (n))] << 4) | hrbit_even[*(tp2 + (n))]] << (i))
 
 	uint8 ConvertTile2h_even (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 	{
 		uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		if (Tile == 0x3ff)
 			tp2 = tp1 - (0x3ff << 4);
@@ -189,15 +162,10 @@ namespace {
 
 		for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -206,9 +174,9 @@ namespace {
 	uint8 ConvertTile4h_even (uint8 *pCache, uint32 TileAddr, uint32 Tile)
 	{
 		uint8	*tp1     = &Memory.VRAM[TileAddr], *tp2;
-		uint32			*p       = (uint32 *) pCache;
-		uint32			non_zero = 0;
-		uint8			line;
+		uint64	*p       = (uint64 *) pCache;
+		uint64	non_zero = 0;
+		uint8	line;
 
 		if (Tile == 0x3ff)
 			tp2 = tp1 - (0x3ff << 5);
@@ -217,17 +185,12 @@ namespace {
 
 		for (line = 8; line != 0; line--, tp1 += 2, tp2 += 2)
 		{
-			uint32			p1 = 0;
-			uint32			p2 = 0;
-			uint8	pix;
-
-			DOBIT( 0, 0);
-			DOBIT( 1, 1);
-			DOBIT(16, 2);
-			DOBIT(17, 3);
-			*p++ = p1;
-			*p++ = p2;
-			non_zero |= p1 | p2;
+			uint64	pix = DOBIT( 0, 0) |
+						  DOBIT( 1, 1) |
+						  DOBIT(16, 2) |
+						  DOBIT(17, 3);
+			*p++ = pix;
+			non_zero |= pix;
 		}
 
 		return (non_zero ? TRUE : BLANK_TILE);
@@ -241,32 +204,23 @@ void S9xInitTileRenderer (void)
 {
 	int	i;
 
-	for (i = 0; i < 16; i++)
+	for (i = 0; i < 256; i++)
 	{
-		uint32	b = 0;
-
-	#ifdef LSB_FIRST
-		if (i & 8)
-			b |= 1;
-		if (i & 4)
-			b |= 1 << 8;
-		if (i & 2)
-			b |= 1 << 16;
-		if (i & 1)
-			b |= 1 << 24;
-	#else
-		if (i & 8)
-			b |= 1 << 24;
-		if (i & 4)
-			b |= 1 << 16;
-		if (i & 2)
-			b |= 1 << 8;
-		if (i & 1)
-			b |= 1;
-	#endif
-
-		for (uint8 bitshift = 0; bitshift < 8; bitshift++)
-			pixbit[bitshift][i] = b << bitshift;
+		uint64	b = 0;
+
+		for (int j = 0; j < 8; j++)
+		{
+			if (i & (0x80 >> j))
+			{
+			#ifdef LSB_FIRST
+				b |= (uint64) 1 << (j << 3);
+			#else
+				b |= (uint64) 1 << ((7 - j) << 3);
+			#endif
+			}
+		}
+
+		pixbit[i] = b;
 	}
 
 	for (i = 0; i < 256; i++)
@@ -296,6 +250,90 @@ void S9xInitTileRenderer (void)
 	}
 }
 
+// Fetch the Mode 7 texels for Count screen pixels of a line. AA/CC are the
+// line's starting X/Y coordinates in 1/256ths (BB/DD already added) and aa/cc
+// the per-pixel step. Pixels outside the 1024x1024 map come from tile 0 with
+// Repeat == 3, and are stored as 0 (transparent) with Repeat == 1 or 2.
+void TileImpl::FetchMode7Line (uint8 *Pix, int Count, int32 AA, int32 CC, int32 aa, int32 cc, uint8 Repeat)
+{
+	uint8	*VRAM  = Memory.VRAM;
+	uint8	*VRAM1 = Memory.VRAM + 1;
+	int		i = 0;
+
+#ifdef __SSE2__
+	// Four pixels at a time: the coordinates and VRAM offsets are computed in
+	// vectors, the two dependent VRAM reads per pixel stay scalar.
+	__m128i	vA    = _mm_setr_epi32(AA, AA + aa, AA + aa * 2, AA + aa * 3);
+	__m128i	vC    = _mm_setr_epi32(CC, CC + cc, CC + cc * 2, CC + cc * 3);
+	__m128i	va    = _mm_set1_epi32(aa * 4);
+	__m128i	vc    = _mm_set1_epi32(cc * 4);
+	__m128i	m3ff  = _mm_set1_epi32(0x3ff);
+	__m128i	m7    = _mm_set1_epi32(7);
+	__m128i	m1    = _mm_set1_epi32(1);
+	__m128i	zero  = _mm_setzero_si128();
+
+	// Bit 22 of a lane keeps the map entry, bit 23 keeps the texel.
+	__m128i	tile_bit = _mm_set1_epi32(1 << 22);
+	__m128i	pix_bit  = _mm_set1_epi32(1 << 23);
+	__m128i	both     = _mm_or_si128(tile_bit, pix_bit);
+	__m128i	outside  = (Repeat == 3) ? pix_bit : zero;
+
+	for (; i + 4 <= Count; i += 4)
+	{
+		__m128i	X = _mm_srai_epi32(vA, 8);
+		__m128i	Y = _mm_srai_epi32(vC, 8);
+		__m128i	keep = both;
+
+		if (Repeat)
+		{
+			__m128i	inside = _mm_cmpeq_epi32(_mm_andnot_si128(m3ff, _mm_or_si128(X, Y)), zero);
+			keep = _mm_or_si128(_mm_and_si128(inside, both), _mm_andnot_si128(inside, outside));
+		}
+
+		X = _mm_and_si128(X, m3ff);
+		Y = _mm_and_si128(Y, m3ff);
+
+		__m128i	map = _mm_add_epi32(_mm_slli_epi32(_mm_andnot_si128(m7, Y), 5), _mm_andnot_si128(m1, _mm_srli_epi32(X, 2)));
+		__m128i	chr = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(Y, m7), 4), _mm_slli_epi32(_mm_and_si128(X, m7), 1));
+		uint32	lanes[4];
+
+		_mm_storeu_si128((__m128i *) lanes, _mm_or_si128(_mm_or_si128(map, _mm_slli_epi32(chr, 15)), keep));
+
+		for (int j = 0; j < 4; j++)
+		{
+			uint32	v    = lanes[j];
+			uint32	tile = VRAM[v & 0x7fff] & -(int32) ((v >> 22) & 1);
+
+			Pix[i + j] = VRAM1[(tile << 7) + ((v >> 15) & 0x7f)] & -(int32) (v >> 23);
+		}
+
+		vA = _mm_add_epi32(vA, va);
+		vC = _mm_add_epi32(vC, vc);
+	}
+
+	AA += aa * i;
+	CC += cc * i;
+#endif
+
+	for (; i < Count; i++, AA += aa, CC += cc)
+	{
+		int	X = AA >> 8;
+		int	Y = CC >> 8;
+
+		if (!Repeat || ((X | Y) & ~0x3ff) == 0)
+		{
+			X &= 0x3ff;
+			Y &= 0x3ff;
+			Pix[i] = *(VRAM1 + (VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7) + ((Y & 7) << 4) + ((X & 7) << 1));
+		}
+		else
+		if (Repeat == 3)
+			Pix[i] = *(VRAM1 + ((Y & 7) << 4) + ((X & 7) << 1));
+		else
+			Pix[i] = 0;
+	}
+}
+
 // Functions to select which converter and renderer to use.
 extern template struct TileImpl::Renderers<DrawTile16, Normal1x1>;
 extern template struct TileImpl::Renderers<DrawClippedTile16, Normal1x1>;
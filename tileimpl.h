@@ -508,6 +508,9 @@ namespace TileImpl {
 
 	#define DRAW_PIXEL(N, M) PIXEL::Draw(N, M, Offset, OffsetInLine, Pix, OP::Z1(D, b), OP::Z2(D, b))
 
+	// Fetches a line of Mode 7 texels, 0 where Mode7Repeat leaves them transparent.
+	void FetchMode7Line (uint8 *Pix, int Count, int32 AA, int32 CC, int32 aa, int32 cc, uint8 Repeat);
+
 	struct DrawMode7BG1_OP
 	{
 		enum {
@@ -536,8 +539,6 @@ namespace TileImpl {
 
 		static void Draw(uint32 Left, uint32 Right, int D)
 		{
-			uint8	*VRAM1 = Memory.VRAM + 1;
-
 			if (OP::DCMODE())
 			{
 				GFX.RealScreenColors = DirectColourMaps[0];
@@ -591,43 +592,15 @@ namespace TileImpl {
 				int	AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
 				int	CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-				uint8	Pix;
-
-				if (!PPU.Mode7Repeat)
-				{
-					for (uint32 x = Left; x < Right; x++, AA += aa, CC += cc)
-					{
-						int	X = ((AA + BB) >> 8) & 0x3ff;
-						int	Y = ((CC + DD) >> 8) & 0x3ff;
+				uint8	Pix, Line7[SNES_WIDTH];
 
-						uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7);
-						uint8	b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1));
+				FetchMode7Line(Line7, Right - Left, AA + BB, CC + DD, aa, cc, PPU.Mode7Repeat);
 
-						Pix = b & OP::MASK; DRAW_PIXEL(x, Pix);
-					}
-				}
-				else
+				for (uint32 x = Left; x < Right; x++)
 				{
-					for (uint32 x = Left; x < Right; x++, AA += aa, CC += cc)
-					{
-						int	X = ((AA + BB) >> 8);
-						int	Y = ((CC + DD) >> 8);
-
-						uint8	b;
+					uint8	b = Line7[x - Left];
 
-						if (((X | Y) & ~0x3ff) == 0)
-						{
-							uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7);
-							b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1));
-						}
-						else
-						if (PPU.Mode7Repeat == 3)
-							b = *(VRAM1    + ((Y & 7) << 4) + ((X & 7) << 1));
-						else
-							continue;
-
-						Pix = b & OP::MASK; DRAW_PIXEL(x, Pix);
-					}
+					Pix = b & OP::MASK; DRAW_PIXEL(x, Pix);
 				}
 			}
 		}
@@ -645,8 +618,6 @@ namespace TileImpl {
 
 		static void Draw(uint32 Left, uint32 Right, int D)
 		{
-			uint8	*VRAM1 = Memory.VRAM + 1;
-
 			if (OP::DCMODE())
 			{
 				GFX.RealScreenColors = DirectColourMaps[0];
@@ -721,64 +692,24 @@ namespace TileImpl {
 				int	AA = l->MatrixA * startx + ((l->MatrixA * xx) & ~63);
 				int	CC = l->MatrixC * startx + ((l->MatrixC * xx) & ~63);
 
-				uint8	Pix;
-				uint8	ctr = 1;
+				uint8	Pix, Line7[SNES_WIDTH];
 
-				if (!PPU.Mode7Repeat)
-				{
-					for (int32 x = MLeft; x < MRight; x++, AA += aa, CC += cc)
-					{
-						if (--ctr)
-							continue;
-						ctr = HMosaic;
+				// Only the first pixel of each HMosaic-wide block is fetched.
+				int	count = (MRight - MLeft) / HMosaic;
 
-						int	X = ((AA + BB) >> 8) & 0x3ff;
-						int	Y = ((CC + DD) >> 8) & 0x3ff;
+				FetchMode7Line(Line7, count, AA + BB, CC + DD, aa * HMosaic, cc * HMosaic, PPU.Mode7Repeat);
 
-						uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7);
-						uint8	b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1));
-
-						if ((Pix = (b & OP::MASK)))
-						{
-							for (int32 h = MosaicStart; h < VMosaic; h++)
-							{
-								for (int32 w = x + HMosaic - 1; w >= x; w--)
-									DRAW_PIXEL(w + h * GFX.PPL, (w >= (int32) Left && w < (int32) Right));
-							}
-						}
-					}
-				}
-				else
+				for (int i = 0; i < count; i++)
 				{
-					for (int32 x = MLeft; x < MRight; x++, AA += aa, CC += cc)
-					{
-						if (--ctr)
-							continue;
-						ctr = HMosaic;
-
-						int	X = ((AA + BB) >> 8);
-						int	Y = ((CC + DD) >> 8);
+					int32	x = MLeft + i * HMosaic;
+					uint8	b = Line7[i];
 
-						uint8	b;
-
-						if (((X | Y) & ~0x3ff) == 0)
-						{
-							uint8	*TileData = VRAM1 + (Memory.VRAM[((Y & ~7) << 5) + ((X >> 2) & ~1)] << 7);
-							b = *(TileData + ((Y & 7) << 4) + ((X & 7) << 1));
-						}
-						else
-						if (PPU.Mode7Repeat == 3)
-							b = *(VRAM1    + ((Y & 7) << 4) + ((X & 7) << 1));
-						else
-							continue;
-
-						if ((Pix = (b & OP::MASK)))
+					if ((Pix = (b & OP::MASK)))
+					{
+						for (int32 h = MosaicStart; h < VMosaic; h++)
 						{
-							for (int32 h = MosaicStart; h < VMosaic; h++)
-							{
-								for (int32 w = x + HMosaic - 1; w >= x; w--)
-									DRAW_PIXEL(w + h * GFX.PPL, (w >= (int32) Left && w < (int32) Right));
-							}
+							for (int32 w = x + HMosaic - 1; w >= x; w--)
+								DRAW_PIXEL(w + h * GFX.PPL, (w >= (int32) Left && w < (int32) Right));
 						}
 					}
 				}
@@ -0,0 +1,143 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+// Headless GSU plot benchmark: draws textured spans through fx_PlotTable in
+// each color depth, the way SuperFX games fill polygons, and reports plots
+// per second. The screen checksum it prints should not change between
+// builds, so two versions of fxinst.cpp can be timed against each other.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "snes9x.h"
+#include "memmap.h"
+#include "fxinst.h"
+#include "fxemu.h"
+
+// The rest of the emulator is not linked in; provide what fxemu.cpp uses.
+struct SSettings	Settings;
+struct SCPUState	CPU;
+struct STimings		Timings;
+struct FxInfo_s		SuperFX;
+struct FxRegs_s		GSU;
+CMemory				Memory;
+
+static uint8	ScreenRAM[0x20000];
+
+static void Usage (void)
+{
+	fprintf(stderr, "usage: fxbench [-passes <n>] [-height <128|160|192>] [-dither]\n");
+	exit(1);
+}
+
+static double GetTime (void)
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1000000.0);
+}
+
+static uint32 Checksum (const uint8 *data, int size)
+{
+	uint32	h = 2166136261u;
+
+	for (int i = 0; i < size; i++)
+		h = (h ^ data[i]) * 16777619u;
+
+	return (h);
+}
+
+// Fills the screen span by span with a texture that has transparent texels,
+// plotting through the same table entry the PLOT opcode uses.
+static void BenchMode (int mode, int bpp, int height, int passes, bool8 dither)
+{
+	static const char	*names[4] = { "2bpp", "4bpp", "4bpp", "8bpp" };
+	uint8				texture[64];
+	int					screen_size = 256 * height * bpp / 8;
+	uint32				plots = 0;
+
+	for (int i = 0; i < 64; i++)
+		texture[i] = (i * 37 + (i >> 3)) & ((1 << bpp) - 1);
+
+	memset(ScreenRAM, 0, sizeof(ScreenRAM));
+
+	GSU.pvScreenBase  = ScreenRAM;
+	GSU.vMode         = mode;
+	GSU.vScreenHeight = height;
+	GSU.vSCBRDirty    = TRUE;
+	fx_computeScreenPointers();
+
+	GSU.vPlotOptionReg = dither ? 0x02 : 0x00;
+	GSU.pvSreg = GSU.pvDreg = &GSU.avReg[0];
+
+	void	(*plot) (void) = fx_PlotTable[mode];
+	double	start = GetTime();
+
+	for (int p = 0; p < passes; p++)
+	{
+		for (int y = 0; y < height; y++)
+		{
+			// Spans start and end off the 8-pixel grid, as polygon edges do.
+			int	left  = (y * 3 + p) & 15;
+			int	right = 256 - ((y * 5 + p) & 15);
+
+			GSU.avReg[1] = left;
+			GSU.avReg[2] = y;
+
+			for (int x = left; x < right; x++)
+			{
+				uint8	c = texture[(x + y * 3 + p) & 63];
+
+				GSU.vColorReg = (dither && bpp < 8) ? (c | (c << 4)) : c;
+				(*plot)();
+			}
+
+			plots += right - left;
+		}
+	}
+
+	double	elapsed = GetTime() - start;
+
+	printf("%s, %d lines%s: %.1f Mplots/s, %.2f ns per plot, screen %08x\n",
+		   names[mode], height, dither ? ", dithered" : "", plots / elapsed / 1000000.0,
+		   elapsed * 1000000000.0 / plots, Checksum(ScreenRAM, screen_size));
+}
+
+int main (int argc, char **argv)
+{
+	int		passes = 2000, height = 192;
+	bool8	dither = FALSE;
+
+	memset(&Settings, 0, sizeof(Settings));
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-passes") && i + 1 < argc)
+			passes = atoi(argv[++i]);
+		else
+		if (!strcmp(argv[i], "-height") && i + 1 < argc)
+			height = atoi(argv[++i]);
+		else
+		if (!strcmp(argv[i], "-dither"))
+			dither = TRUE;
+		else
+			Usage();
+	}
+
+	if (passes <= 0 || (height != 128 && height != 160 && height != 192))
+		Usage();
+
+	fx_initOpcodeTable();
+
+	BenchMode(0, 2, height, passes, dither);
+	BenchMode(1, 4, height, passes, dither);
+	BenchMode(3, 8, height, passes, dither);
+
+	return (0);
+}
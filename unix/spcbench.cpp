@@ -0,0 +1,240 @@
+/*****************************************************************************\
+     Snes9x - Portable Super Nintendo Entertainment System (TM) emulator.
+                This file is licensed under the Snes9x License.
+   For further information, consult the LICENSE file in the root directory.
+\*****************************************************************************/
+
+// Headless SPC renderer: runs the SMP and DSP alone on an .spc snapshot as
+// fast as possible, optionally writing the output to a WAV file, and reports
+// how long the APU took per sample. With -resample it also times converting
+// the output to another rate at each output resampler quality.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "snes9x.h"
+#include "apu/apu.h"
+#include "apu/resampler.h"
+#include "apu/bapu/snes/snes.hpp"
+
+// The rest of the emulator is not linked in; provide what the APU uses.
+struct SSettings	Settings;
+
+namespace SNES {
+CPU	cpu;
+}
+
+void S9xMSU1Generate (size_t sample_count)
+{
+}
+
+static const int	SPC_SAMPLE_RATE = 32000;
+static const int	BLOCK_SAMPLES   = 256;
+
+static void Usage (void)
+{
+	fprintf(stderr, "usage: spcbench <file.spc> [-seconds <n>] [-interpolation <0-4>] [-resample <rate>] [-o <file.wav>]\n");
+	exit(1);
+}
+
+static void WriteLE (FILE *fp, uint32 value, int bytes)
+{
+	for (int i = 0; i < bytes; i++)
+		fputc((value >> (i * 8)) & 0xff, fp);
+}
+
+static void WriteWAVHeader (FILE *fp, uint32 data_size)
+{
+	fwrite("RIFF", 4, 1, fp);
+	WriteLE(fp, 36 + data_size, 4);
+	fwrite("WAVEfmt ", 8, 1, fp);
+	WriteLE(fp, 16, 4);
+	WriteLE(fp, 1, 2);						// PCM
+	WriteLE(fp, 2, 2);						// stereo
+	WriteLE(fp, SPC_SAMPLE_RATE, 4);
+	WriteLE(fp, SPC_SAMPLE_RATE * 4, 4);
+	WriteLE(fp, 4, 2);
+	WriteLE(fp, 16, 2);
+	fwrite("data", 4, 1, fp);
+	WriteLE(fp, data_size, 4);
+}
+
+static double GetTime (void)
+{
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec + tv.tv_usec / 1000000.0);
+}
+
+// Feeds the rendered output through the resampler at each Sound::ResamplerQuality
+// setting, in blocks as the APU does, and reports the input samples per second.
+static void BenchResampler (int16 *input, int count, int rate)
+{
+	static const char	*names[4] = { "Hermite", "Sinc, 16 taps", "Sinc, 32 taps", "Sinc, 64 taps" };
+	int16				buffer[BLOCK_SAMPLES * 2 * 2];
+
+	for (int q = 0; q < 4; q++)
+	{
+		Resampler	resampler(BLOCK_SAMPLES * 2 * 2);
+		int			produced = 0;
+
+		resampler.quality(q);
+		resampler.time_ratio((double) SPC_SAMPLE_RATE / rate);
+
+		double	start = GetTime();
+
+		for (int done = 0; done < count; done += BLOCK_SAMPLES * 2)
+		{
+			resampler.push(input + done, count - done < BLOCK_SAMPLES * 2 ? count - done : BLOCK_SAMPLES * 2);
+
+			int	avail;
+			while ((avail = resampler.avail()) > 0)
+			{
+				if (avail > BLOCK_SAMPLES * 2 * 2)
+					avail = BLOCK_SAMPLES * 2 * 2;
+				resampler.read(buffer, avail);
+				produced += avail;
+			}
+		}
+
+		double	elapsed = GetTime() - start;
+
+		printf("%-13s %d -> %d Hz: %.0f samples/s (%.1fx real time), %d samples out\n",
+			   names[q], SPC_SAMPLE_RATE, rate, count / 2 / elapsed, count / 2 / elapsed / SPC_SAMPLE_RATE, produced / 2);
+	}
+}
+
+int main (int argc, char **argv)
+{
+	const char	*spc_name = NULL, *wav_name = NULL;
+	int			seconds = 60, resample_rate = 0;
+
+	memset(&Settings, 0, sizeof(Settings));
+	Settings.InterpolationMethod = DSP_INTERPOLATION_GAUSSIAN;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-seconds") && i + 1 < argc)
+			seconds = atoi(argv[++i]);
+		else
+		if (!strcmp(argv[i], "-interpolation") && i + 1 < argc)
+			Settings.InterpolationMethod = atoi(argv[++i]);
+		else
+		if (!strcmp(argv[i], "-resample") && i + 1 < argc)
+			resample_rate = atoi(argv[++i]);
+		else
+		if (!strcmp(argv[i], "-o") && i + 1 < argc)
+			wav_name = argv[++i];
+		else
+		if (argv[i][0] != '-' && !spc_name)
+			spc_name = argv[i];
+		else
+			Usage();
+	}
+
+	if (!spc_name || seconds <= 0 || resample_rate < 0)
+		Usage();
+
+	static uint8	spc[SPC_FILE_SIZE];
+	FILE			*fp = fopen(spc_name, "rb");
+
+	if (!fp)
+	{
+		fprintf(stderr, "Couldn't open %s.\n", spc_name);
+		return (1);
+	}
+
+	size_t	size = fread(spc, 1, SPC_FILE_SIZE, fp);
+	fclose(fp);
+
+	if (size < SPC_FILE_SIZE || memcmp(spc, "SNES-SPC700 Sound File Data", 27))
+	{
+		fprintf(stderr, "%s is not an SPC file.\n", spc_name);
+		return (1);
+	}
+
+	FILE	*wav = NULL;
+
+	if (wav_name)
+	{
+		wav = fopen(wav_name, "wb");
+		if (!wav)
+		{
+			fprintf(stderr, "Couldn't open %s for writing.\n", wav_name);
+			return (1);
+		}
+
+		WriteWAVHeader(wav, 0);
+	}
+
+	// Room for two blocks, since the SMP can overshoot a block by an instruction
+	Resampler	output(BLOCK_SAMPLES * 2 * 2);
+	int16		buffer[BLOCK_SAMPLES * 2 * 2];
+
+	SNES::cpu.reset();
+	SNES::smp.power();
+	SNES::dsp.power();
+	SNES::dsp.spc_dsp.set_output(&output);
+	SNES::smp.load_spc(spc);
+
+	// The SMP runs at 32 clocks per DSP sample and keeps the DSP's clock
+	// alongside its own.
+	int		total = seconds * SPC_SAMPLE_RATE;
+	int16	*rendered = NULL;
+	int		rendered_count = 0;
+
+	if (resample_rate)
+		rendered = new int16[(total + BLOCK_SAMPLES * 2) * 2];
+
+	double	start = GetTime();
+
+	for (int done = 0; done < total; done += BLOCK_SAMPLES)
+	{
+		SNES::smp.clock -= BLOCK_SAMPLES * 32;
+		SNES::smp.enter();
+		SNES::dsp.synchronize();
+
+		int	count = output.space_filled();
+		output.pull(buffer, count);
+
+		if (rendered)
+		{
+			memcpy(rendered + rendered_count, buffer, count * 2);
+			rendered_count += count;
+		}
+
+		if (wav)
+		{
+		#ifndef LSB_FIRST
+			for (int i = 0; i < count; i++)
+				buffer[i] = (int16) (((uint16) buffer[i] >> 8) | ((uint16) buffer[i] << 8));
+		#endif
+			fwrite(buffer, 2, count, wav);
+		}
+	}
+
+	double	elapsed = GetTime() - start;
+
+	if (wav)
+	{
+		uint32	data_size = (uint32) ftell(wav) - 44;
+
+		fseek(wav, 0, SEEK_SET);
+		WriteWAVHeader(wav, data_size);
+		fclose(wav);
+	}
+
+	printf("%d samples in %.3f s: %.0f samples/s (%.1fx real time), %.1f ns per DSP sample\n",
+		   total, elapsed, total / elapsed, total / elapsed / SPC_SAMPLE_RATE, elapsed * 1e9 / total);
+
+	if (rendered)
+	{
+		BenchResampler(rendered, rendered_count, resample_rate);
+		delete[] rendered;
+	}
+
+	return (0);
+}
@@ -20,6 +20,7 @@
 #include <sched.h>
 #include <pthread.h>
 #include <vector>
+#include <atomic>
 #endif
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -177,15 +178,18 @@ namespace {
 			m_BufferSize = int(uint64(sampleRateHz) * bufferSizeMS / 1000 * 4);
 
 #if defined(USE_THREADS)
-			m_WrittenSize = 0;
 			m_Thread = pthread_t();
 			m_isExit = false;
 			if (isThreaded)
 			{
-				m_BufferMutex = PTHREAD_MUTEX_INITIALIZER;
-				m_hasBuffer = PTHREAD_COND_INITIALIZER;
+				// The game thread only moves m_WritePos and the audio thread only moves
+				// m_ReadPos, so neither ever waits on the other.
+				m_Ring.resize(m_BufferSize);
+				m_ReadPos = 0;
+				m_WritePos = 0;
 				if (pthread_create(&m_Thread, NULL, AudioOutputThreadEntry, this))
 				{
+					m_Thread = pthread_t();
 					return;
 				}
 			}
@@ -197,16 +201,8 @@ namespace {
 #if defined(USE_THREADS)
 			if (m_Thread)
 			{
-				pthread_mutex_lock(&m_BufferMutex);
-				{
-					m_isExit = true;
-					pthread_cond_signal(&m_hasBuffer);
-				}
-				pthread_mutex_unlock(&m_BufferMutex);
-
+				m_isExit = true;
 				pthread_join(m_Thread, NULL);
-				pthread_mutex_destroy(&m_BufferMutex);
-				pthread_cond_destroy(&m_hasBuffer);
 			}
 #endif
 		}
@@ -216,19 +212,20 @@ namespace {
 #if defined(USE_THREADS)
 			if (m_Thread)
 			{
-				pthread_mutex_lock(&m_BufferMutex);
-				{
-					if (int(m_Buffering.size()) < m_BufferSize)
-					{
-						size_t oldSize = m_Buffering.size();
-						size_t newSize = oldSize + size;
-						m_WrittenSize = newSize;
-						m_Buffering.resize(newSize);
-						memcpy(&m_Buffering[oldSize], data, size);
-						pthread_cond_signal(&m_hasBuffer);
-					}
-				}
-				pthread_mutex_unlock(&m_BufferMutex);
+				// Drop the block if the output has fallen too far behind, as a full device would
+				if (size > GetFreeBufferSize())
+					return;
+
+				int writePos = m_WritePos.load(std::memory_order_relaxed);
+				int firstSize = std::min(size, m_BufferSize - writePos);
+
+				memcpy(&m_Ring[writePos], data, firstSize);
+				memcpy(&m_Ring[0], (const uint8 *) data + firstSize, size - firstSize);
+
+				writePos += size;
+				if (writePos >= m_BufferSize)
+					writePos -= m_BufferSize;
+				m_WritePos.store(writePos, std::memory_order_release);
 			}
 			else
 #endif
@@ -242,13 +239,11 @@ namespace {
 #if defined(USE_THREADS)
 			if (m_Thread)
 			{
-				int writtenSize;
-				pthread_mutex_lock(&m_BufferMutex);
-				{
-					writtenSize = m_WrittenSize;
-				}
-				pthread_mutex_unlock(&m_BufferMutex);
-				return m_BufferSize - writtenSize;
+				// One byte stays unused so a full ring can be told from an empty one
+				int filled = m_WritePos.load(std::memory_order_relaxed) - m_ReadPos.load(std::memory_order_acquire);
+				if (filled < 0)
+					filled += m_BufferSize;
+				return m_BufferSize - 1 - filled;
 			}
 			else
 #endif
@@ -260,20 +255,27 @@ namespace {
 			}
 		}
 
+		int GetBufferSize()
+		{
+			return m_BufferSize;
+		}
+
 	private:
-		void WriteImpl(const void* data, int size)
+		// Returns the number of bytes written, stopping early if the device is full
+		int WriteImpl(const void* data, int size)
 		{
 			const char* p = reinterpret_cast<const char*>(data);
-			while (size > 0)
+			int written = 0;
+			while (written < size)
 			{
-				int result = write(m_FD, p, size);
+				int result = write(m_FD, p + written, size - written);
 				if (result < 0)
 				{
-					return;
+					break;
 				}
-				p += result;
-				size -= result;
+				written += result;
 			}
+			return written;
 		}
 
 		int m_FD;
@@ -281,12 +283,10 @@ namespace {
 
 #if defined(USE_THREADS)
 		pthread_t m_Thread;
-		volatile bool m_isExit;
-		pthread_mutex_t m_BufferMutex;
-		pthread_cond_t m_hasBuffer;
-		std::vector<uint8> m_PlayingBuffer;
-		std::vector<uint8> m_Buffering;
-		int m_WrittenSize; // for dynamic rate control
+		std::atomic<bool> m_isExit;
+		std::vector<uint8> m_Ring;
+		std::atomic<int> m_ReadPos;
+		std::atomic<int> m_WritePos;
 
 		static void* AudioOutputThreadEntry(void* arg)
 		{
@@ -297,25 +297,24 @@ namespace {
 
 		void AudioOutputThread()
 		{
-			while (true)
+			while (! m_isExit)
 			{
-				pthread_mutex_lock(&m_BufferMutex);
-				{
-					pthread_cond_wait(&m_hasBuffer, &m_BufferMutex);
-					if (m_isExit)
-					{
-						return;
-					}
-					m_PlayingBuffer.swap(m_Buffering);
-					m_WrittenSize = 0;
-				}
-				pthread_mutex_unlock(&m_BufferMutex);
+				int readPos = m_ReadPos.load(std::memory_order_relaxed);
+				int writePos = m_WritePos.load(std::memory_order_acquire);
+				int size = (writePos >= readPos ? writePos : m_BufferSize) - readPos;
+				int written = size ? WriteImpl(&m_Ring[readPos], size) : 0;
 
-				if (! m_PlayingBuffer.empty())
+				if (written)
 				{
-					WriteImpl(&m_PlayingBuffer[0], m_PlayingBuffer.size());
-					m_PlayingBuffer.resize(0);
+					readPos += written;
+					if (readPos >= m_BufferSize)
+						readPos -= m_BufferSize;
+					m_ReadPos.store(readPos, std::memory_order_release);
 				}
+
+				// Nothing queued or the device is full: sleep for about a millisecond
+				if (written < size || size == 0)
+					usleep(1000);
 			}
 		}
 #endif // USE_THREADS
@@ -1333,7 +1332,7 @@ void S9xSamplesAvailable(void *data)
 
     if (Settings.DynamicRateControl)
     {
-        S9xUpdateDynamicRate(s_AudioOutput->GetFreeBufferSize(), so.fragment_size * 4);
+        S9xUpdateDynamicRate(s_AudioOutput->GetFreeBufferSize(), s_AudioOutput->GetBufferSize());
     }
 
     samples_to_write = S9xGetSampleCount();
@@ -1463,6 +1462,10 @@ int main (int argc, char **argv)
 	Settings.InitialInfoStringTimeout = 120;
 	Settings.HDMATimingHack = 100;
 	Settings.BlockInvalidVRAMAccessMaster = TRUE;
+	Settings.SkipIdleLoopsMaster = TRUE;
+	Settings.BatchSA1Master = FALSE;
+	Settings.LazyAPUSync = FALSE;
+	Settings.ResamplerQuality = 0;
 	Settings.StopEmulation = TRUE;
 	Settings.WrongMovieStateProtection = TRUE;
 	Settings.DumpStreamsMaxFrames = -1;
@@ -88,7 +88,9 @@ struct GUIData
 	Window			window;
 	Image			*image;
 	uint8			*snes_buffer;
+	uint8			*snes_buffer32;
 	uint8			*filter_buffer;
+	uint8			*last_buffer;
 	uint8			*blit_screen;
 	uint32			blit_screen_pitch;
 	bool8			need_convert;
@@ -173,6 +175,7 @@ static void TakedownXvImage (void);
 static void Repaint (bool8);
 static void Convert16To24 (int, int);
 static void Convert16To24Packed (int, int);
+static void BlitScreen32 (int, int, int, int);
 
 
 void S9xExtraDisplayUsage (void)
@@ -934,6 +937,13 @@ static void SetupImage (void)
 
 	GFX.Screen = (uint16 *) (GUI.snes_buffer + (GFX.Pitch * 2 * 2));
 
+	// Lets S9xPutImage skip frames that didn't change
+	GUI.last_buffer = (uint8 *) calloc(GFX.Pitch * SNES_HEIGHT_EXTENDED * 2, 1);
+	if (!GUI.last_buffer)
+		FatalError("Failed to allocate GUI.last_buffer.");
+
+	GFX.LastScreen = (uint16 *) GUI.last_buffer;
+
 	GUI.filter_buffer = (uint8 *) calloc((SNES_WIDTH * 2) * 2 * (SNES_HEIGHT_EXTENDED * 2), 1);
 	if (!GUI.filter_buffer)
 		FatalError("Failed to allocate GUI.filter_buffer.");
@@ -956,6 +966,22 @@ static void SetupImage (void)
 	}
 	if (GUI.need_convert) { printf("\tImage conversion needed before blit.\n"); }
 
+	// On an XRGB8888 visual the core keeps a 32-bit copy of the screen, which
+	// the plain scalers copy from without any conversion.
+#ifdef USE_XVIDEO
+	if (GUI.need_convert && !GUI.use_xvideo &&
+#else
+	if (GUI.need_convert &&
+#endif
+		GUI.image->bits_per_pixel == 32 && GUI.red_shift == 16 && GUI.green_shift == 8 && GUI.blue_shift == 0)
+	{
+		GUI.snes_buffer32 = (uint8 *) calloc(GFX.Pitch * 2 * ((SNES_HEIGHT_EXTENDED + 4) * 2), 1);
+		if (!GUI.snes_buffer32)
+			FatalError("Failed to allocate GUI.snes_buffer32.");
+
+		GFX.Screen32 = (uint32 *) (GUI.snes_buffer32 + (GFX.Pitch * 2 * 2 * 2));
+	}
+
 	S9xGraphicsInit();
 }
 
@@ -967,12 +993,26 @@ static void TakedownImage (void)
 		GUI.snes_buffer = NULL;
 	}
 
+	if (GUI.snes_buffer32)
+	{
+		free(GUI.snes_buffer32);
+		GUI.snes_buffer32 = NULL;
+		GFX.Screen32 = NULL;
+	}
+
 	if (GUI.filter_buffer)
 	{
 		free(GUI.filter_buffer);
 		GUI.filter_buffer = NULL;
 	}
 
+	if (GUI.last_buffer)
+	{
+		free(GUI.last_buffer);
+		GUI.last_buffer = NULL;
+		GFX.LastScreen = NULL;
+	}
+
 	if (GUI.image)
 	{
 #ifdef USE_XVIDEO
@@ -1211,9 +1251,11 @@ static void TakedownXvImage (void)
 
 void S9xPutImage (int width, int height)
 {
-	static int	prevWidth = 0, prevHeight = 0;
-	int			copyWidth, copyHeight;
-	Blitter		blitFn = NULL;
+	static int		prevWidth = 0, prevHeight = 0, prevVideoMode = -1;
+	static Blitter	prevBlitFn = NULL;
+	int				copyWidth, copyHeight;
+	Blitter			blitFn = NULL;
+	bool8			direct;
 
 	if (GUI.video_mode == VIDEOMODE_BLOCKY || GUI.video_mode == VIDEOMODE_TV || GUI.video_mode == VIDEOMODE_SMOOTH)
 		if ((width <= SNES_WIDTH) && ((prevWidth != width) || (prevHeight != height)))
@@ -1263,8 +1305,31 @@ void S9xPutImage (int width, int height)
 		copyHeight = height;
 		blitFn = S9xBlitPixSimple1x1;
 	}
-	blitFn((uint8 *) GFX.Screen, GFX.Pitch, GUI.blit_screen, GUI.blit_screen_pitch, width, height);
 
+	// Same size, same filter and no line changed: the blit and image buffers
+	// still hold this frame, so only put it on screen again.
+	if (width == prevWidth && height == prevHeight && blitFn == prevBlitFn &&
+		GUI.video_mode == prevVideoMode && S9xChangedLines() == 0)
+	{
+		Repaint(TRUE);
+		return;
+	}
+
+	// The plain scalers only repeat pixels, so they can take GFX.Screen32.
+	direct = GFX.Screen32 && (blitFn == S9xBlitPixSimple1x1 || blitFn == S9xBlitPixSimple1x2 ||
+							  blitFn == S9xBlitPixSimple2x1 || blitFn == S9xBlitPixSimple2x2);
+
+	if (direct)
+		BlitScreen32(width, height, copyWidth / width, copyHeight / height);
+	else
+		blitFn((uint8 *) GFX.Screen, GFX.Pitch, GUI.blit_screen, GUI.blit_screen_pitch, width, height);
+
+	if (direct && height < prevHeight)
+	{
+		for (int y = copyHeight; y < SNES_HEIGHT_EXTENDED * 2; y++)
+			memset(GUI.image->data + y * GUI.image->bytes_per_line, 0, SNES_WIDTH * 2 * 4);
+	}
+	else
 	if (height < prevHeight)
 	{
 		int	p = GUI.blit_screen_pitch >> 2;
@@ -1310,7 +1375,7 @@ void S9xPutImage (int width, int height)
 	}
 	else
 #endif
-	if (GUI.need_convert)
+	if (GUI.need_convert && !direct)
 	{
 		if (GUI.bytes_per_pixel == 3)
 			Convert16To24Packed(copyWidth, copyHeight);
@@ -1320,8 +1385,10 @@ void S9xPutImage (int width, int height)
 
 	Repaint(TRUE);
 
-	prevWidth  = width;
-	prevHeight = height;
+	prevWidth     = width;
+	prevHeight    = height;
+	prevBlitFn    = blitFn;
+	prevVideoMode = GUI.video_mode;
 }
 
 static void Convert16To24 (int width, int height)
@@ -1426,6 +1493,27 @@ static void Convert16To24Packed (int width, int height)
 	}
 }
 
+static void BlitScreen32 (int width, int height, int xscale, int yscale)
+{
+	for (int y = 0; y < height; y++)
+	{
+		uint32	*s = GFX.Screen32 + y * GFX.RealPPL;
+		uint8	*d = (uint8 *) GUI.image->data + y * yscale * GUI.image->bytes_per_line;
+
+		if (xscale == 2)
+		{
+			uint32	*p = (uint32 *) d;
+			for (int x = 0; x < width; x++, p += 2)
+				p[0] = p[1] = s[x];
+		}
+		else
+			memcpy(d, s, width * 4);
+
+		if (yscale == 2)
+			memcpy(d + GUI.image->bytes_per_line, d, width * xscale * 4);
+	}
+}
+
 static void Repaint (bool8 isFrameBoundry)
 {
 #ifdef USE_XVIDEO
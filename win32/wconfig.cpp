@@ -804,6 +804,8 @@ void WinRegisterConfigItems()
 	AddUIntC("TurboFrameSkip", Settings.TurboSkipFrames, 15, "how many frames to skip when in fast-forward mode");
 	AddUInt("AutoSaveDelay", Settings.AutoSaveDelay, 30);
 	AddBool("BlockInvalidVRAMAccess", Settings.BlockInvalidVRAMAccessMaster, true);
+	AddBool("SkipIdleLoops", Settings.SkipIdleLoopsMaster, true);
+	AddBoolC("BatchSA1", Settings.BatchSA1Master, false, "true to let the SA-1 run in batches behind the CPU (faster, but SA-1 timing differs, so movies and netplay need the same setting)");
 	AddBool2C("SnapshotScreenshots", Settings.SnapshotScreenshots, true, "on to save the screenshot in each snapshot, for loading-when-paused display");
 	AddBoolC("MovieTruncateAtEnd", Settings.MovieTruncate, true, "true to truncate any leftover data in the movie file after the current frame when recording stops");
 	AddBoolC("MovieNotifyIgnored", Settings.MovieNotifyIgnored, false, "true to display \"(ignored)\" in the frame counter when recording when the last frame of input was not used by the SNES (such as lag or loading frames)");
@@ -854,8 +856,10 @@ void WinRegisterConfigItems()
 	AddUIntC("InputRate", Settings.SoundInputRate, 31950, "for each 'Input rate' samples generated by the SNES, 'Playback rate' samples will produced. If you experience crackling you can try to lower this setting.");
 	AddBoolC("Mute", GUI.Mute, false, "true to mute sound output (does not disable the sound CPU)");
 	AddBool("DynamicRateControl", Settings.DynamicRateControl, false);
+	AddBoolC("LazySync", Settings.LazyAPUSync, false, "true to run the sound CPU only when the game talks to it or a block of samples is due");
 	AddBool("AutomaticInputRate", GUI.AutomaticInputRate, true);
 	AddIntC("InterpolationMethod", Settings.InterpolationMethod, 2, "0 = None, 1 = Linear, 2 = Gaussian (accurate), 3 = Cubic, 4 = Sinc");
+	AddIntC("ResamplerQuality", Settings.ResamplerQuality, 0, "output resampler: 0 = Hermite, 1 = Sinc (16 taps), 2 = Sinc (32 taps), 3 = Sinc (64 taps)");
 #undef CATEGORY
 #define	CATEGORY "Sound\\Win"
 	AddUIntC("SoundDriver", GUI.SoundDriver, 4, "4=XAudio2 (recommended), 8=WaveOut");